@@ -131,12 +131,15 @@ protected nomask object getTarget(object owner, string command)
 
         if (sizeof(targetId) == 3)
         {
-            ret = present(targetId[2], environment(owner)) ||
+            object location = environment(owner);
+            ret = (function_exists("findInRoom", location) ?
+                location->findInRoom(targetId[2]) :
+                present(targetId[2], location)) ||
                 present(targetId[2], owner);
 
-            if (!ret && environment(owner)->isEnvironmentalElement(targetId[2]))
+            if (!ret && location->isEnvironmentalElement(targetId[2]))
             {
-                ret = environment(owner)->getEnvironmentalElement(targetId[2]);
+                ret = location->getEnvironmentalElement(targetId[2]);
             }
         }
     }
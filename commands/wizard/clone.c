@@ -38,8 +38,13 @@ public nomask int execute(string command, object initiator)
                 if (newObj)
                 {
                     ret = 1;
-                    move_object(newObj, (newObj->get() ? initiator :
-                        environment(initiator)));
+                    object destination = newObj->get() ? initiator :
+                        environment(initiator);
+                    move_object(newObj, destination);
+                    if (function_exists("updateContentsIndex", destination))
+                    {
+                        destination->updateContentsIndex(newObj);
+                    }
                     tell_object(initiator, sprintf("Cloned object '%s'.\n",
                         targetPath));
                 }
@@ -35,11 +35,25 @@ public nomask int execute(string command, object initiator)
             target = find_living(targetString);
         }
 
+        string landmark = load_object(
+            "/lib/dictionaries/navigationDictionary.c")->landmarkLocation(
+            targetString);
+
         object destination = 0;
         if (target)
         {
             destination = environment(target) || target;
         }
+        else if (landmark)
+        {
+            // Landmarks can be registered by cloned rooms, which can only
+            // be found - not loaded - by name.
+            destination = find_object(landmark);
+            if (!destination && (member(landmark, '#') < 0))
+            {
+                destination = load_object(landmark);
+            }
+        }
         else
         {
             if (!sizeof(regexp(({ targetString }), ".+\.c$")))
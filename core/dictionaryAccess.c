@@ -0,0 +1,42 @@
+//*****************************************************************************
+// Class: dictionaryAccess
+// File Name: dictionaryAccess.c
+//
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//
+// Description: Dictionary access gives the objects that inherit it the
+//              dictionaries they ask for. Each dictionary is resolved through
+//              the dictionary registry the first time it is used and only
+//              again once its blueprint has been destructed.
+//
+//*****************************************************************************
+private nosave string DictionaryRegistry = "/lib/core/dictionaryRegistry.c";
+private nosave mapping dictionaryHandles = ([]);
+
+//-----------------------------------------------------------------------------
+// Method: getDictionary
+// Description: This method returns the dictionary object for the queried
+//              service or null if the dictionary does not exist. It will load
+//              the dictionary blueprint if it is not already loaded by the
+//              driver.
+//
+// Parameters: service - the dictionary to check for
+//
+// Returns: the dictionary object if it's a valid dictionary.
+//-----------------------------------------------------------------------------
+protected object getDictionary(string service)
+{
+    object ret = member(dictionaryHandles, service) ?
+        dictionaryHandles[service] : 0;
+
+    if (!ret && service && stringp(service))
+    {
+        ret = load_object(DictionaryRegistry)->getDictionary(service);
+        if (ret)
+        {
+            dictionaryHandles[service] = ret;
+        }
+    }
+    return ret;
+}
@@ -0,0 +1,58 @@
+//*****************************************************************************
+// Class: dictionaryRegistry
+// File Name: dictionaryRegistry.c
+//
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//
+// Description: The dictionary registry resolves a dictionary's file once and
+//              hands out the loaded blueprint from then on. A dictionary is
+//              only resolved again after its blueprint has been destructed,
+//              which is also what updating it does.
+//
+//*****************************************************************************
+private nosave string DictionaryDirectory = "/lib/dictionaries";
+
+// service -> dictionary blueprint
+private nosave mapping dictionaries = ([]);
+
+//-----------------------------------------------------------------------------
+// Method: getDictionary
+// Description: This method returns the dictionary object for the queried
+//              service or null if the dictionary does not exist.
+//
+// Parameters: service - the dictionary to get
+//
+// Returns: the dictionary object if it's a valid dictionary.
+//-----------------------------------------------------------------------------
+public nomask object getDictionary(string service)
+{
+    object ret = 0;
+
+    if (service && stringp(service))
+    {
+        ret = member(dictionaries, service) ? dictionaries[service] : 0;
+
+        if (!ret)
+        {
+            string dictionary = sprintf("%s/%sDictionary.c",
+                DictionaryDirectory, service);
+
+            ret = find_object(dictionary[0..<3]);
+            if (!ret && (file_size(dictionary) > -1))
+            {
+                ret = load_object(dictionary);
+            }
+
+            if (ret)
+            {
+                dictionaries[service] = ret;
+            }
+            else
+            {
+                m_delete(dictionaries, service);
+            }
+        }
+    }
+    return ret;
+}
@@ -35,11 +35,16 @@ private nosave string *validEventHandlers = ({ "onDeath", "onHeartBeat",
     "onNoLongerSoaked", "onCannotEatMore", "onHungry", "onBeginDetox",
     "onSaveSucceeded", "onRestoreSucceeded", "onRestoreFailed", "onStateChanged",
     "onConversationResponse", "receiveEvent", "onCraftingStarted", 
-    "onCraftingCompleted", "onCraftingAborted", "onMessageReceived"
+    "onCraftingCompleted", "onCraftingAborted", "onMessageReceived",
+    "onTimeOfDayChanged", "onSeasonChanged"
 });
     
 private nosave mapping eventList = ([ ]);
 
+// How many times each event has been sent. Anything caching facts about
+// this object can compare these to know when the facts may have changed.
+private nosave mapping eventCounts = ([ ]);
+
 //-----------------------------------------------------------------------------
 // Method: registerEvent
 // Description: This method is used to register event handlers that will
@@ -155,6 +160,8 @@ public varargs nomask int notify(string event, mixed message)
     
     if(event && stringp(event) && (member(validEventHandlers, event) > -1))
     {
+        eventCounts[event]++;
+
         // delete all null handlers
         m_delete(eventList, 0);
         
@@ -189,6 +196,8 @@ public varargs nomask int notifySynchronous(string event, mixed message)
 
     if (event && stringp(event) && (member(validEventHandlers, event) > -1))
     {
+        eventCounts[event]++;
+
         // delete all null handlers
         m_delete(eventList, 0);
 
@@ -222,3 +231,30 @@ public nomask varargs void processEventCallOut(object handler, string event,
         call_other(handler, event, this_object(), message);
     }
 }
+
+//-----------------------------------------------------------------------------
+// Method: eventCount
+// Description: This method returns the number of times that the passed
+//              events have been sent by this object. Since it only ever
+//              increases, a changed count means that at least one of the
+//              events has occurred.
+//
+// Parameters: events - the events to count
+//
+// Returns: the total number of times the events have been sent
+//-----------------------------------------------------------------------------
+public nomask int eventCount(string *events)
+{
+    int ret = 0;
+    if (pointerp(events))
+    {
+        foreach(string event in events)
+        {
+            if (member(eventCounts, event))
+            {
+                ret += eventCounts[event];
+            }
+        }
+    }
+    return ret;
+}
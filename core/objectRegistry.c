@@ -0,0 +1,328 @@
+//*****************************************************************************
+// Class: objectRegistry
+// File Name: objectRegistry.c
+//
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//
+// Description: The object registry resolves trait and research files once,
+//              validates the loaded blueprint and hands it out from then on.
+//              An object is only resolved again after its blueprint has been
+//              destructed, which is also what updating it does.
+//
+//              When a preload manifest has been generated, every file in it
+//              is loaded once the login object asks for it, which happens
+//              when the login blueprint is first loaded. Files are loaded a
+//              slice at a time across call_outs so that compiling hundreds
+//              of traits and research items happens at startup instead of
+//              during play.
+//
+//*****************************************************************************
+private nosave string PreloadManifest = "/lib/core/preloadManifest.txt";
+private nosave string *PreloadDirectories = ({ "/lib/modules/traits",
+    "/lib/instances/research" });
+private nosave int PreloadBatchSize = 10;
+
+// type -> ([ "program": <program it must inherit>,
+//            "validation": <method that must return true>,
+//            "underscores": <spaces in relative names are underscores> ])
+private nosave mapping ObjectTypes = ([
+    "trait": ([
+        "program": "lib/modules/traits/baseTrait.c",
+        "validation": "isValidTrait"
+    ]),
+    "research": ([
+        "program": "lib/modules/research/researchItem.c",
+        "validation": "isValidResearchItem",
+        "underscores": 1
+    ]),
+    "research tree": ([
+        "program": "lib/modules/research/researchTree.c",
+        "underscores": 1
+    ])
+]);
+
+// type -> file -> blueprint
+private nosave mapping registeredObjects = ([
+    "trait": ([]),
+    "research": ([]),
+    "research tree": ([])
+]);
+
+// ([ "pending", "loaded", "failed", "scheduled" ])
+private nosave mapping preload = 0;
+
+//-----------------------------------------------------------------------------
+// Method: normalizeName
+// Description: This method returns the file name for the passed object name
+//              the same way the trait and research dictionaries always have.
+//-----------------------------------------------------------------------------
+private nomask string normalizeName(string type, string name)
+{
+    string ret = name;
+    if (ret[0] != '/')
+    {
+        if (member(ObjectTypes[type], "underscores"))
+        {
+            ret = regreplace(ret, " ", "_", 1);
+        }
+        ret = "/" + ret;
+    }
+    return ret;
+}
+
+//-----------------------------------------------------------------------------
+// Method: isObjectOfType
+// Description: This method returns true if the passed blueprint inherits the
+//              program for the passed type and reports itself as valid.
+//-----------------------------------------------------------------------------
+private nomask int isObjectOfType(object blueprint, string type)
+{
+    return blueprint &&
+        (member(inherit_list(blueprint), ObjectTypes[type]["program"]) > -1) &&
+        (!member(ObjectTypes[type], "validation") ||
+            call_other(blueprint, ObjectTypes[type]["validation"]));
+}
+
+//-----------------------------------------------------------------------------
+// Method: getObject
+// Description: This method returns the blueprint for the passed trait or
+//              research file, loading and validating it the first time it is
+//              asked for.
+//
+// Parameters: type - trait, research or research tree
+//             name - the file containing the object
+//
+// Returns: the blueprint or null if the file is not a valid object of type.
+//-----------------------------------------------------------------------------
+public nomask object getObject(string type, string name)
+{
+    object ret = 0;
+
+    if (type && member(ObjectTypes, type) && name && stringp(name) &&
+        sizeof(name))
+    {
+        string file = normalizeName(type, name);
+        ret = member(registeredObjects[type], file) ?
+            registeredObjects[type][file] : 0;
+
+        if (!ret && (file_size(file) > 0))
+        {
+            ret = load_object(file);
+            if (!isObjectOfType(ret, type))
+            {
+                ret = 0;
+            }
+        }
+
+        if (ret)
+        {
+            registeredObjects[type][file] = ret;
+        }
+        else
+        {
+            m_delete(registeredObjects[type], file);
+        }
+    }
+    return ret;
+}
+
+//-----------------------------------------------------------------------------
+// Method: expandDirectory
+// Description: This method returns every file in the passed directory and
+//              its subdirectories.
+//-----------------------------------------------------------------------------
+private nomask string *expandDirectory(string directory)
+{
+    string *ret = ({});
+    string *files = sort_array(get_dir(directory + "/*", 0x01) || ({}),
+        (: $1 > $2 :));
+
+    foreach(string file in files)
+    {
+        string path = directory + "/" + file;
+        if ((file != ".") && (file != ".."))
+        {
+            if (file_size(path) == -2)
+            {
+                ret += expandDirectory(path);
+            }
+            else if ((sizeof(file) > 2) && (file[<2..] == ".c"))
+            {
+                ret += ({ path });
+            }
+        }
+    }
+    return ret;
+}
+
+//-----------------------------------------------------------------------------
+// Method: preloadManifest
+// Description: This method returns the file that lists what to preload.
+//-----------------------------------------------------------------------------
+protected string preloadManifest()
+{
+    return PreloadManifest;
+}
+
+//-----------------------------------------------------------------------------
+// Method: generatePreloadManifest
+// Description: This method writes every trait and research file to the
+//              preload manifest, replacing the one that is there. Only
+//              callers that can access the database may do this.
+//
+// Returns: the number of files in the manifest
+//-----------------------------------------------------------------------------
+public nomask int generatePreloadManifest()
+{
+    if (!canAccessDatabase(previous_object()))
+    {
+        raise_error(sprintf("ERROR in objectRegistry.c: %O is not allowed "
+            "to generate the preload manifest.\n", previous_object()));
+    }
+
+    string manifest = preloadManifest();
+
+    string *files = ({});
+    foreach(string directory in PreloadDirectories)
+    {
+        files += expandDirectory(directory);
+    }
+
+    if (file_size(manifest) > -1)
+    {
+        rm(manifest);
+    }
+    write_file(manifest, implode(files, "\n") + "\n");
+    return sizeof(files);
+}
+
+//-----------------------------------------------------------------------------
+// Method: preloadFile
+// Description: This method loads the passed file and registers it under each
+//              type that it is a valid object of.
+//-----------------------------------------------------------------------------
+private nomask void preloadFile(string file)
+{
+    object blueprint = 0;
+    string err = catch (blueprint = load_object(file); nolog);
+
+    if (err || !blueprint)
+    {
+        preload["failed"][file] = err || "The file could not be loaded.\n";
+    }
+    else
+    {
+        foreach(string type in m_indices(ObjectTypes))
+        {
+            int isValid = 0;
+            err = catch (isValid = isObjectOfType(blueprint, type); nolog);
+
+            if (err)
+            {
+                preload["failed"][file] = err;
+            }
+            else if (isValid)
+            {
+                registeredObjects[type][file] = blueprint;
+            }
+        }
+        preload["loaded"]++;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Method: processPreload
+// Description: This method loads the next slice of files in the preload
+//              manifest and schedules the following slice if there is one.
+//
+// Returns: the number of files still waiting to be loaded
+//-----------------------------------------------------------------------------
+public nomask int processPreload()
+{
+    int ret = 0;
+
+    if (preload && sizeof(preload["pending"]))
+    {
+        string *files = preload["pending"][0..(PreloadBatchSize - 1)];
+        preload["pending"] = preload["pending"][PreloadBatchSize..];
+
+        foreach(string file in files)
+        {
+            preloadFile(file);
+        }
+
+        ret = sizeof(preload["pending"]);
+        if (ret && !preload["scheduled"])
+        {
+            preload["scheduled"] = 1;
+            call_out("continuePreload", 1);
+        }
+    }
+    return ret;
+}
+
+//-----------------------------------------------------------------------------
+// Method: continuePreload
+// Description: This method is the call_out that loads each preload slice.
+//-----------------------------------------------------------------------------
+static nomask void continuePreload()
+{
+    if (preload)
+    {
+        preload["scheduled"] = 0;
+        processPreload();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Method: preloadObjects
+// Description: This method starts loading every file listed in the preload
+//              manifest. Blank lines and lines starting with # are ignored.
+//              The manifest is only ever preloaded once.
+//
+// Returns: true if there were files to preload
+//-----------------------------------------------------------------------------
+public nomask int preloadObjects()
+{
+    int ret = 0;
+    string manifest = preloadManifest();
+
+    if (!preload && (file_size(manifest) > 0))
+    {
+        string *files = filter(explode(read_file(manifest), "\n"),
+            (: sizeof($1) && ($1[0] != '#') :));
+
+        preload = ([
+            "pending": map(files, (: ($1[0] == '/') ? $1 : "/" + $1 :)),
+            "loaded": 0,
+            "failed": ([]),
+            "scheduled": 1
+        ]);
+        call_out("continuePreload", 0);
+        ret = sizeof(files) > 0;
+    }
+    return ret;
+}
+
+//-----------------------------------------------------------------------------
+// Method: preloadStatus
+// Description: This method returns how far along preloading is.
+//
+// Returns: ([ "pending": <files left>, "loaded": <files loaded>,
+//             "failed": ([ <file>: <error> ]) ]) or null if nothing has been
+//          preloaded.
+//-----------------------------------------------------------------------------
+public nomask mapping preloadStatus()
+{
+    mapping ret = 0;
+    if (preload)
+    {
+        ret = ([
+            "pending": sizeof(preload["pending"]),
+            "loaded": preload["loaded"],
+            "failed": preload["failed"] + ([])
+        ]);
+    }
+    return ret;
+}
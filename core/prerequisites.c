@@ -56,6 +56,29 @@ protected mapping prerequisites = ([
 // ])
 ]);
 
+// Prerequisite types whose facts are announced through events when they
+// change. When a researcher gets these facts from the lib's own modules,
+// their checks are cached until one of the events is sent.
+// type -> ({ program, ({ functions }), ({ events }) })
+private nosave mapping CachedPrerequisiteTypes = ([
+    "research": ({ "lib/modules/research.c", ({ "isResearched" }),
+        ({ "onResearchCompleted", "onRestoreSucceeded" }) }),
+    "quest": ({ "lib/modules/quests.c", ({ "questIsCompleted" }),
+        ({ "onQuestCompleted", "onRestoreSucceeded" }) }),
+    "guild": ({ "lib/modules/guilds.c", ({ "memberOfGuild" }),
+        ({ "onJoinGuild", "onLeaveGuild", "onRestoreSucceeded" }) }),
+    "level": ({ "lib/modules/guilds.c", ({ "memberOfGuild", "guildLevel",
+        "effectiveLevel" }), ({ "onAdvancedLevel", "onJoinGuild",
+        "onLeaveGuild", "onRestoreSucceeded" }) }),
+    "trait": ({ "lib/modules/traits.c", ({ "isTraitOf" }),
+        ({ "onTraitAdded", "onTraitRemoved", "onRestoreSucceeded" }) })
+]);
+
+// researcher -> ([ grouping: ([ "cached": ({ prerequisites }),
+//     "live": ({ prerequisites }), "events": ({ events }),
+//     "event count": <count>, "result": <result of cached checks> ]) ])
+private nosave mapping prerequisiteResults = ([]);
+
 //-----------------------------------------------------------------------------
 // Method: isValidPrerequisiteType
 // Description: This method will return true if the supplied prerequisite type
@@ -152,12 +175,14 @@ protected nomask varargs int addPrerequisite(string key, mapping prerequisite, s
             prerequisites[grouping] = ([]);
         }
         prerequisites[grouping] += ([key:prerequisite]);
+        prerequisiteResults = ([]);
         ret = 1;
     }
     else if(!grouping && key && stringp(key) && validPrerequisite(prerequisite) &&
        !member(prerequisites, key))
     {
         prerequisites[key] = prerequisite + ([ ]);
+        prerequisiteResults = ([]);
         ret = 1;
     }
     return ret;
@@ -458,6 +483,186 @@ private nomask int checkCombatStats(object researcher, string type, int value)
     return ret;
 }
 
+//-----------------------------------------------------------------------------
+// Method: checkPrerequisite
+// Description: This method will check whether or not the passed researcher
+//              meets a single prerequisite.
+//
+// Parameters: researcher - the object to check
+//             prerequisite - the key/name of the prerequisite
+//             prerequisiteData - the prerequisite details mapping
+//             owner - the object whose opinion of the researcher matters
+//
+// Returns: true if the researcher object meets the prerequisite.
+//-----------------------------------------------------------------------------
+private nomask int checkPrerequisite(object researcher, string prerequisite,
+    mapping prerequisiteData, object owner)
+{
+    int ret = 1;
+
+    switch (prerequisiteData["type"])
+    {
+        case "research":
+        {
+            // This should NOT be used to handle prerequisites
+            // that would exist within a single research tree
+            // structure.
+            ret &&= checkResearch(researcher, prerequisite);
+            break;
+        }
+        case "attribute":
+        {
+            ret &&= checkAttribute(researcher, prerequisite,
+                prerequisiteData["value"]);
+            break;
+        }
+        case "skill":
+        {
+            ret &&= checkSkill(researcher, prerequisite,
+                prerequisiteData["value"]);
+            break;
+        }
+        case "quest":
+        {
+            ret &&= checkQuest(researcher, prerequisite);
+            break;
+        }
+        case "guild":
+        {
+            ret &&= checkGuilds(researcher, prerequisiteData["value"]);
+            break;
+        }
+        case "race":
+        {
+            ret &&= checkRaces(researcher, prerequisiteData["value"]);
+            break;
+        }
+        case "faction":
+        {
+            ret &&= checkFactions(researcher, prerequisiteData["value"]);
+            break;
+        }
+        case "trait":
+        {
+            ret &&= checkTraits(researcher, prerequisiteData["value"]);
+            break;
+        }
+        case "background":
+        {
+            ret &&= checkBackground(researcher, prerequisiteData["value"]);
+            break;
+        }
+        case "level":
+        {
+            ret &&= (member(prerequisiteData, "guild") ?
+                checkLevel(researcher, prerequisiteData["value"],
+                    prerequisiteData["guild"]) :
+                checkLevel(researcher, prerequisiteData["value"]));
+            break;
+        }
+        case "combat statistic":
+        {
+            ret &&= checkCombatStats(researcher, prerequisite,
+                prerequisiteData["value"]);
+            break;
+        }
+        case "opinion":
+        {
+            ret &&= owner && (owner->opinionOf(researcher) >=
+                prerequisiteData["value"]);
+            break;
+        }
+        case "state":
+        {
+            ret &&= researcher && member(prerequisiteData, "state key") &&
+                (researcher->stateFor(load_object(prerequisiteData["state key"])) ==
+                prerequisiteData["value"]);
+            break;
+        }
+        default:
+        {
+            ret = 0;
+            break;
+        }
+    }
+    return ret;
+}
+
+//-----------------------------------------------------------------------------
+// Method: prerequisiteIsCacheable
+// Description: This method will return true if the passed researcher's
+//              facts for the passed prerequisite type come from the lib's
+//              own modules, which send events when those facts change.
+//
+// Parameters: researcher - the object to check
+//             type - the prerequisite type
+//
+// Returns: true if checks of this type can be cached for the researcher.
+//-----------------------------------------------------------------------------
+private nomask int prerequisiteIsCacheable(object researcher, string type)
+{
+    int ret = objectp(researcher) && member(CachedPrerequisiteTypes, type);
+
+    if (ret)
+    {
+        mapping programs = ([ "eventCount": "lib/core/events.c" ]);
+        foreach(string method in CachedPrerequisiteTypes[type][1])
+        {
+            programs[method] = CachedPrerequisiteTypes[type][0];
+        }
+
+        foreach(string method, string program in programs)
+        {
+            string source = function_exists(method, researcher);
+            if (source && sizeof(source) && (source[0] == '/'))
+            {
+                source = source[1..];
+            }
+            ret &&= (source == program);
+        }
+    }
+    return ret;
+}
+
+//-----------------------------------------------------------------------------
+// Method: compilePrerequisites
+// Description: This method splits the prerequisites to check for a researcher
+//              into those that can be cached until the researcher sends one
+//              of a set of events and those that must always be checked.
+//
+// Parameters: researcher - the object to check
+//             grouping - the grouping of prerequisites to check
+//
+// Returns: the compiled prerequisites.
+//-----------------------------------------------------------------------------
+private nomask mapping compilePrerequisites(object researcher, string grouping)
+{
+    mapping ret = ([ "cached": ({}), "live": ({}), "events": ({}) ]);
+
+    string *prerequisiteList = (grouping && member(prerequisites, grouping)) ?
+        m_indices(prerequisites[grouping]) : m_indices(prerequisites);
+
+    foreach(string prerequisite in prerequisiteList)
+    {
+        mapping prerequisiteData = getPrerequisite(prerequisite, grouping);
+        if (prerequisiteData)
+        {
+            string type = prerequisiteData["type"];
+            if (prerequisiteIsCacheable(researcher, type))
+            {
+                ret["cached"] += ({ ({ prerequisite, prerequisiteData }) });
+                ret["events"] += CachedPrerequisiteTypes[type][2] - 
+                    ret["events"];
+            }
+            else
+            {
+                ret["live"] += ({ ({ prerequisite, prerequisiteData }) });
+            }
+        }
+    }
+    return ret;
+}
+
 //-----------------------------------------------------------------------------
 // Method: checkPrerequisites
 // Description: This method will check whether or not the passed researcher
@@ -471,103 +676,52 @@ private nomask int checkCombatStats(object researcher, string type, int value)
 public nomask varargs int checkPrerequisites(object researcher, string grouping, object owner)
 {
     int ret = 1;
-    
-    string *prerequisiteList = (grouping && member(prerequisites, grouping)) ?
-        m_indices(prerequisites[grouping]) : m_indices(prerequisites);
-    if(sizeof(prerequisiteList))
+
+    if (!(grouping && member(prerequisites, grouping)))
+    {
+        grouping = 0;
+    }
+
+    mapping compiled = 0;
+    if (objectp(researcher))
+    {
+        if (!member(prerequisiteResults, researcher))
+        {
+            prerequisiteResults[researcher] = ([]);
+        }
+        if (!member(prerequisiteResults[researcher], grouping))
+        {
+            prerequisiteResults[researcher][grouping] =
+                compilePrerequisites(researcher, grouping);
+        }
+        compiled = prerequisiteResults[researcher][grouping];
+    }
+    else
+    {
+        compiled = compilePrerequisites(researcher, grouping);
+    }
+
+    if (sizeof(compiled["cached"]))
     {
-        foreach(string prerequisite in prerequisiteList)
+        int eventCount = researcher->eventCount(compiled["events"]);
+        if (!member(compiled, "result") || 
+            (compiled["event count"] != eventCount))
         {
-            mapping prerequisiteData = getPrerequisite(prerequisite, grouping);
-            if (prerequisiteData)
+            int result = 1;
+            foreach(mixed *check in compiled["cached"])
             {
-                switch (prerequisiteData["type"])
-                {
-                    case "research":
-                    {
-                        // This should NOT be used to handle prerequisites
-                        // that would exist within a single research tree
-                        // structure.
-                        ret &&= checkResearch(researcher, prerequisite);
-                        break;
-                    }
-                    case "attribute":
-                    {
-                        ret &&= checkAttribute(researcher, prerequisite,
-                            prerequisiteData["value"]);
-                        break;
-                    }
-                    case "skill":
-                    {
-                        ret &&= checkSkill(researcher, prerequisite,
-                            prerequisiteData["value"]);
-                        break;
-                    }
-                    case "quest":
-                    {
-                        ret &&= checkQuest(researcher, prerequisite);
-                        break;
-                    }
-                    case "guild":
-                    {
-                        ret &&= checkGuilds(researcher, prerequisiteData["value"]);
-                        break;
-                    }
-                    case "race":
-                    {
-                        ret &&= checkRaces(researcher, prerequisiteData["value"]);
-                        break;
-                    }
-                    case "faction":
-                    {
-                        ret &&= checkFactions(researcher, prerequisiteData["value"]);
-                        break;
-                    }
-                    case "trait":
-                    {
-                        ret &&= checkTraits(researcher, prerequisiteData["value"]);
-                        break;
-                    }
-                    case "background":
-                    {
-                        ret &&= checkBackground(researcher, prerequisiteData["value"]);
-                        break;
-                    }
-                    case "level":
-                    {
-                        ret &&= (member(prerequisiteData, "guild") ?
-                            checkLevel(researcher, prerequisiteData["value"],
-                                prerequisiteData["guild"]) :
-                            checkLevel(researcher, prerequisiteData["value"]));
-                        break;
-                    }
-                    case "combat statistic":
-                    {
-                        ret &&= checkCombatStats(researcher, prerequisite,
-                            prerequisiteData["value"]);
-                        break;
-                    }
-                    case "opinion":
-                    {
-                        ret &&= owner && (owner->opinionOf(researcher) >=
-                            prerequisiteData["value"]);
-                        break;
-                    }
-                    case "state":
-                    {
-                        ret &&= researcher && member(prerequisiteData, "state key") &&
-                            (researcher->stateFor(load_object(prerequisiteData["state key"])) ==
-                            prerequisiteData["value"]);
-                        break;
-                    }
-                    default:
-                    {
-                        ret = 0;
-                        break;
-                    }
-                }
+                result &&= checkPrerequisite(researcher, check[0], check[1],
+                    owner);
             }
+            compiled["event count"] = eventCount;
+            compiled["result"] = result;
         }
+        ret = compiled["result"];
+    }
+
+    foreach(mixed *check in compiled["live"])
+    {
+        ret &&= checkPrerequisite(researcher, check[0], check[1], owner);
     }
     return ret;
 }
@@ -5,6 +5,7 @@
 // Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
 //                      the accompanying LICENSE file for details.
 //*****************************************************************************
+virtual inherit "/lib/core/dictionaryAccess.c";
 
 protected mapping researchData = ([
     // "name": <name of the research>
@@ -27,22 +28,26 @@ protected mapping researchData = ([
     // Other data is specified in specific type-inherited methods
 ]);
 
-/////////////////////////////////////////////////////////////////////////////
-protected nomask object getDictionary(string service)
-{
-    object ret = 0;
+// Limiters are checked cheapest first: the target's and owner's own state
+// before anything that has to go through a dictionary or the owner's
+// equipment. Verbose checks keep the order the messages are written in.
+private nosave string *LimiterOrder = ({ "crafting type", "opponent race",
+    "opponent guild", "opponent faction", "intoxicated", "drugged",
+    "near death", "stamina drained", "spell points drained", "environment",
+    "equipment" });
+private nosave string *VerboseLimiterOrder = ({ "opponent race",
+    "opponent guild", "opponent faction", "crafting type", "environment",
+    "intoxicated", "drugged", "near death", "stamina drained",
+    "spell points drained", "equipment" });
 
-    if (service && stringp(service))
-    {
-        string dictionary = sprintf("/lib/dictionaries/%sDictionary.c",
-            service);
-        if (file_size(dictionary) > -1)
-        {
-            ret = load_object(dictionary);
-        }
-    }
-    return ret;
-}
+// ({ ({ limiter, check closure, value }) }) in LimiterOrder
+private nosave mixed *compiledLimiters = 0;
+
+// owner -> ([ limiter: ({ time checked, key, result }) ])
+// The environment and equipment limiters are the expensive ones. Their
+// results are kept until the owner moves or changes equipment, but never
+// past the current second so that a result can't outlive a combat round.
+private nosave mapping limiterResults = ([]);
 
 /////////////////////////////////////////////////////////////////////////////
 protected nomask int validLimitor(mapping limitor)
@@ -200,6 +205,8 @@ protected int addSpecification(string type, mixed value)
                 {
                     ret = 1;
                     researchData["limited by"] = value;
+                    compiledLimiters = 0;
+                    limiterResults = ([]);
                 }
                 else
                 {
@@ -235,147 +242,355 @@ protected int blockSkillApplication(string skill, object owner, object target)
 }
 
 /////////////////////////////////////////////////////////////////////////////
-public nomask varargs int canApplySkill(string skill, object owner, object target, int verbose)
+private nomask int limitedByOpponentRace(object owner, object target,
+    string race)
+{
+    return target && objectp(target) && function_exists("Race", target) &&
+        (target->Race() == race);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int limitedByOpponentGuild(object owner, object target,
+    string guild)
+{
+    return target && objectp(target) &&
+        function_exists("memberOfGuild", target) &&
+        target->memberOfGuild(guild);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int limitedByOpponentFaction(object owner, object target,
+    string faction)
+{
+    return target && objectp(target) &&
+        function_exists("memberOfFaction", target) &&
+        target->memberOfFaction(faction);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int limitedByCraftingType(object owner, object target,
+    string type)
+{
+    return target && (target->query("crafting type") == type);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int limitedByEnvironment(object owner, object target,
+    string type)
 {
     int ret = 1;
+    object environmentDictionary = getDictionary("environment");
+    if (environmentDictionary)
+    {
+        ret = environment(owner) &&
+            environmentDictionary->isEnvironmentOfType(environment(owner),
+                type);
+    }
+    return ret;
+}
 
-    if (member(researchData, "limited by") && owner && objectp(owner))
+/////////////////////////////////////////////////////////////////////////////
+private nomask int limitedByIntoxication(object owner, object target,
+    int level)
+{
+    return function_exists("Intoxicated", owner) &&
+        (owner->Intoxicated() >= level);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int limitedByDrugs(object owner, object target, int level)
+{
+    return function_exists("Drugged", owner) && (owner->Drugged() >= level);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int limitedByNearDeath(object owner, object target, int level)
+{
+    return function_exists("hitPoints", owner) &&
+        (owner->hitPoints() <= level);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int limitedByStaminaDrained(object owner, object target,
+    int level)
+{
+    return function_exists("staminaPoints", owner) &&
+        (owner->staminaPoints() <= level);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int limitedBySpellPointsDrained(object owner, object target,
+    int level)
+{
+    return function_exists("spellPoints", owner) &&
+        (owner->spellPoints() <= level);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int limitedByEquipment(object owner, object target,
+    mixed equipment)
+{
+    int ret = 0;
+    if (pointerp(equipment) && sizeof(equipment))
     {
-        if (member(researchData["limited by"], "opponent race"))
+        foreach(string item in equipment)
         {
-            ret &&= target && objectp(target) &&
-                function_exists("Race", target) && (target->Race() ==
-                    researchData["limited by"]["opponent race"]);
-            if (!ret && verbose)
-            {
-                printf("Your opponent is not of the %s race.\n",
-                    researchData["limited by"]["opponent race"]);
-            }
+            ret ||= owner->usingEquipmentOfType(item);
         }
-        if (member(researchData["limited by"], "opponent guild"))
+    }
+    else
+    {
+        ret = function_exists("usingEquipmentOfType", owner) &&
+            owner->usingEquipmentOfType(equipment);
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask closure limiterCheck(string limiter)
+{
+    closure ret = 0;
+    switch (limiter)
+    {
+        case "opponent race":
         {
-            ret &&= target && objectp(target) &&
-                function_exists("memberOfGuild", target) &&
-                target->memberOfGuild(
-                    researchData["limited by"]["opponent guild"]);
-            if (!ret && verbose)
-            {
-                printf("Your opponent is not of the %s guild.\n",
-                    researchData["limited by"]["opponent guild"]);
-            }
+            ret = #'limitedByOpponentRace;
+            break;
         }
-        if (member(researchData["limited by"], "opponent faction"))
+        case "opponent guild":
         {
-            ret &&= target && objectp(target) &&
-                function_exists("memberOfFaction", target) &&
-                target->memberOfFaction(
-                    researchData["limited by"]["opponent faction"]);
-            if (!ret && verbose)
-            {
-                object faction = getDictionary("factions")->factionObject(
-                    researchData["limited by"]["opponent faction"]);
+            ret = #'limitedByOpponentGuild;
+            break;
+        }
+        case "opponent faction":
+        {
+            ret = #'limitedByOpponentFaction;
+            break;
+        }
+        case "crafting type":
+        {
+            ret = #'limitedByCraftingType;
+            break;
+        }
+        case "environment":
+        {
+            ret = #'limitedByEnvironment;
+            break;
+        }
+        case "intoxicated":
+        {
+            ret = #'limitedByIntoxication;
+            break;
+        }
+        case "drugged":
+        {
+            ret = #'limitedByDrugs;
+            break;
+        }
+        case "near death":
+        {
+            ret = #'limitedByNearDeath;
+            break;
+        }
+        case "stamina drained":
+        {
+            ret = #'limitedByStaminaDrained;
+            break;
+        }
+        case "spell points drained":
+        {
+            ret = #'limitedBySpellPointsDrained;
+            break;
+        }
+        case "equipment":
+        {
+            ret = #'limitedByEquipment;
+            break;
+        }
+    }
+    return ret;
+}
 
-                if (faction)
-                {
-                    printf("Your opponent is not of the %s faction.\n",
-                        faction->name());
-                }
-            }
+/////////////////////////////////////////////////////////////////////////////
+private nomask mixed *compileLimiters(string *order)
+{
+    mixed *ret = ({});
+    foreach(string limiter in order)
+    {
+        if (member(researchData["limited by"], limiter))
+        {
+            ret += ({ ({ limiter, limiterCheck(limiter),
+                researchData["limited by"][limiter] }) });
         }
-        if (member(researchData["limited by"], "crafting type"))
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int definedIn(string method, object owner, string program)
+{
+    string source = function_exists(method, owner);
+    if (source && (source[0] == '/'))
+    {
+        source = source[1..];
+    }
+    return source == program;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask mixed limiterCacheKey(string limiter, object owner)
+{
+    mixed ret = 0;
+    if ((limiter == "environment") && environment(owner))
+    {
+        ret = environment(owner);
+    }
+    else if ((limiter == "equipment") &&
+        definedIn("eventCount", owner, "lib/core/events.c") &&
+        definedIn("usingEquipmentOfType", owner, "lib/modules/inventory.c"))
+    {
+        // Counts start at zero, so the key is offset to tell it apart from
+        // "cannot be cached".
+        ret = 1 + owner->eventCount(({ "onEquip", "onUnequip" }));
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int checkLimiter(mixed *limiter, object owner, object target)
+{
+    int ret = 0;
+    mixed key = limiterCacheKey(limiter[0], owner);
+
+    if (key)
+    {
+        if (!member(limiterResults, owner))
         {
-            ret &&= target && (target->query("crafting type") ==
-                    researchData["limited by"]["crafting type"]);
-            if (!ret && verbose)
-            {
-                printf("The item is of the wrong type to be affected by this research.\n");
-            }
+            limiterResults[owner] = ([]);
         }
-        if (member(researchData["limited by"], "environment"))
+
+        mixed *cached = limiterResults[owner][limiter[0]];
+        if (cached && (cached[0] == time()) && (cached[1] == key))
         {
-            object environmentDictionary =
-                getDictionary("environment");
-            if (environmentDictionary)
-            {
-                ret &&= environment(owner) &&
-                    environmentDictionary->isEnvironmentOfType(environment(owner),
-                        researchData["limited by"]["environment"]);
-            }
-            if (!ret && verbose)
-            {
-                printf("You are not in the correct environment (%s) to do that.\n",
-                    researchData["limited by"]["environment"]);
-            }
+            ret = cached[2];
         }
-        if (member(researchData["limited by"], "intoxicated"))
+        else
         {
-            ret &&= function_exists("Intoxicated", owner) &&
-                (owner->Intoxicated() >=
-                    researchData["limited by"]["intoxicated"]);
-            if (!ret && verbose)
-            {
-                printf("You are not intoxicated enough to do that.\n");
-            }
+            ret = funcall(limiter[1], owner, target, limiter[2]);
+            limiterResults[owner][limiter[0]] = ({ time(), key, ret });
         }
-        if (member(researchData["limited by"], "drugged"))
+    }
+    else
+    {
+        ret = funcall(limiter[1], owner, target, limiter[2]);
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void displayLimiterFailure(string limiter, mixed value)
+{
+    switch (limiter)
+    {
+        case "opponent race":
         {
-            ret &&= function_exists("Drugged", owner) &&
-                (owner->Drugged() >= researchData["limited by"]["drugged"]);
-            if (!ret && verbose)
-            {
-                printf("You are not drugged enough to do that.\n");
-            }
+            printf("Your opponent is not of the %s race.\n", value);
+            break;
         }
-        if (member(researchData["limited by"], "near death"))
+        case "opponent guild":
         {
-            ret &&= function_exists("hitPoints", owner) &&
-                (owner->hitPoints() <= researchData["limited by"]["near death"]);
-            if (!ret && verbose)
-            {
-                printf("You are not injured enough to do that.\n");
-            }
+            printf("Your opponent is not of the %s guild.\n", value);
+            break;
         }
-        if (member(researchData["limited by"], "stamina drained"))
+        case "opponent faction":
         {
-            ret &&= function_exists("staminaPoints", owner) &&
-                (owner->staminaPoints() <= researchData["limited by"]["stamina drained"]);
-            if (!ret && verbose)
+            object faction = getDictionary("factions")->factionObject(value);
+            if (faction)
             {
-                printf("You are not weary enough to do that.\n");
+                printf("Your opponent is not of the %s faction.\n",
+                    faction->name());
             }
+            break;
         }
-        if (member(researchData["limited by"], "spell points drained"))
+        case "crafting type":
         {
-            ret &&= function_exists("spellPoints", owner) &&
-                (owner->spellPoints() <= researchData["limited by"]["spell points drained"]);
-            if (!ret && verbose)
-            {
-                printf("You are not drained enough to do that.\n");
-            }
+            printf("The item is of the wrong type to be affected by this research.\n");
+            break;
+        }
+        case "environment":
+        {
+            printf("You are not in the correct environment (%s) to do that.\n",
+                value);
+            break;
+        }
+        case "intoxicated":
+        {
+            printf("You are not intoxicated enough to do that.\n");
+            break;
+        }
+        case "drugged":
+        {
+            printf("You are not drugged enough to do that.\n");
+            break;
+        }
+        case "near death":
+        {
+            printf("You are not injured enough to do that.\n");
+            break;
         }
-        if (member(researchData["limited by"], "equipment"))
+        case "stamina drained":
         {
-            if (pointerp(researchData["limited by"]["equipment"]) &&
-                sizeof(researchData["limited by"]["equipment"]))
+            printf("You are not weary enough to do that.\n");
+            break;
+        }
+        case "spell points drained":
+        {
+            printf("You are not drained enough to do that.\n");
+            break;
+        }
+        case "equipment":
+        {
+            printf("You must be using the proper equipment for that (%s).\n",
+                value);
+            break;
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask varargs int canApplySkill(string skill, object owner, object target, int verbose)
+{
+    int ret = 1;
+
+    if (member(researchData, "limited by") && owner && objectp(owner))
+    {
+        if (verbose)
+        {
+            // Every unmet limiter is reported, so nothing is skipped or
+            // cached here.
+            foreach(mixed *limiter in compileLimiters(VerboseLimiterOrder))
             {
-                int hasEquipment = 0;
-                string *list = researchData["limited by"]["equipment"];
-                foreach(string equipment in list)
+                ret &&= funcall(limiter[1], owner, target, limiter[2]);
+                if (!ret)
                 {
-                    hasEquipment ||= owner->usingEquipmentOfType(equipment);
+                    displayLimiterFailure(limiter[0], limiter[2]);
                 }
-                ret &&= hasEquipment;
             }
-            else
+        }
+        else
+        {
+            if (!compiledLimiters)
             {
-                ret &&= function_exists("usingEquipmentOfType", owner) &&
-                    owner->usingEquipmentOfType(researchData["limited by"]["equipment"]);
+                compiledLimiters = compileLimiters(LimiterOrder);
             }
 
-            if (!ret && verbose)
+            foreach(mixed *limiter in compiledLimiters)
             {
-                printf("You must be using the proper equipment for that (%s).\n",
-                    researchData["limited by"]["equipment"]);
+                if (!checkLimiter(limiter, owner, target))
+                {
+                    ret = 0;
+                    break;
+                }
             }
         }
     }
@@ -11,7 +11,125 @@
 //              with the various lib modules.
 //
 //*****************************************************************************
+virtual inherit "/lib/core/dictionaryAccess.c";
+
 private nosave string LibDirectory = "lib";
+private nosave string RealizationProgram = "lib/realizations/realization.c";
+
+// The modules, core objects and realizations this program is built from.
+// Inheritance is fixed when the program is compiled, so this is worked out
+// once per program and the same mapping is shared by every clone.
+private nosave mapping programServices = 0;
+
+//-----------------------------------------------------------------------------
+// Method: programInDirectory
+// Description: This method returns the name of the passed program relative to
+//              the passed lib directory, or null if it is not in it.
+//-----------------------------------------------------------------------------
+private nomask string programInDirectory(string program, string directory)
+{
+    string ret = 0;
+    string prefix = sprintf("%s/%s/", LibDirectory, directory);
+
+    if (program && (program[0] == '/'))
+    {
+        program = program[1..];
+    }
+    if (program && (sizeof(program) > (sizeof(prefix) + 2)) &&
+        (program[0..(sizeof(prefix) - 1)] == prefix) &&
+        (program[<2..] == ".c"))
+    {
+        ret = program[sizeof(prefix)..<3];
+    }
+    return ret;
+}
+
+//-----------------------------------------------------------------------------
+// Method: compileProgramServices
+// Description: This method resolves the modules, core objects and
+//              realizations this program has been integrated with.
+//-----------------------------------------------------------------------------
+private nomask mapping compileProgramServices()
+{
+    mapping ret = ([ "services": ([]), "realizations": ([]),
+        "realization handler": 0 ]);
+
+    string handler = function_exists("isRealizationOf", this_object());
+    if (handler && (handler[0] == '/'))
+    {
+        handler = handler[1..];
+    }
+    ret["realization handler"] = handler;
+
+    foreach(string program in inherit_list(this_object()))
+    {
+        string service = programInDirectory(program, "modules") ||
+            programInDirectory(program, "core");
+
+        if (service)
+        {
+            ret["services"][service] = 1;
+        }
+
+        string realization = programInDirectory(program, "realizations");
+        if (realization && (handler == RealizationProgram))
+        {
+            string check = "isRealizationOf" + capitalize(realization);
+            if (function_exists(check, this_object()) &&
+                call_other(this_object(), check))
+            {
+                ret["realizations"][realization] = 1;
+            }
+        }
+    }
+    return ret;
+}
+
+//-----------------------------------------------------------------------------
+// Method: getProgramServices
+// Description: This method returns the resolved services for this program,
+//              borrowing them from the program's blueprint when it can.
+//-----------------------------------------------------------------------------
+private nomask mapping getProgramServices()
+{
+    if (!programServices)
+    {
+        object blueprint = clonep(this_object()) ?
+            find_object(program_name(this_object())[0..<3]) : 0;
+
+        if (blueprint && (blueprint != this_object()) &&
+            (program_time(blueprint) == program_time(this_object())))
+        {
+            programServices = blueprint->sharedProgramServices();
+        }
+
+        if (!programServices)
+        {
+            programServices = compileProgramServices();
+        }
+    }
+    return programServices;
+}
+
+//-----------------------------------------------------------------------------
+// Method: sharedProgramServices
+// Description: This method hands the resolved services of this program to
+//              other instances of the same program so that they do not have
+//              to resolve them again.
+//
+// Returns: the resolved services if the caller is built from this program.
+//-----------------------------------------------------------------------------
+public nomask mapping sharedProgramServices()
+{
+    mapping ret = 0;
+    if (previous_object() && (previous_object() != this_object()) &&
+        (program_name(previous_object()) == program_name(this_object())) &&
+        (program_time(previous_object()) == program_time(this_object())))
+    {
+        ret = getProgramServices();
+    }
+    return ret;
+}
 
 //-----------------------------------------------------------------------------
 // Method: has
@@ -24,19 +142,8 @@ private nosave string LibDirectory = "lib";
 //-----------------------------------------------------------------------------
 public int has(string service)
 {
-    int ret = 0;
-    
-    if(service && stringp(service) && (member(inherit_list(this_object()),
-       sprintf("%s/modules/%s.c", LibDirectory, service)) > -1))
-    {
-        ret = 1;
-    }
-    else if (service && stringp(service) && (member(inherit_list(this_object()),
-        sprintf("%s/core/%s.c", LibDirectory, service)) > -1))
-    {
-        ret = 1;
-    }
-    return ret;
+    return service && stringp(service) &&
+        member(getProgramServices()["services"], service);
 }
 
 //-----------------------------------------------------------------------------
@@ -55,38 +162,20 @@ protected object getService(string service)
     {
         ret = this_object();
     }
-    else if(function_exists("isRealizationOf", this_object()))
-    {
-        ret = call_other(this_object(), "isRealizationOf", service);
-    }
-
-    return ret;
-}
-
-//-----------------------------------------------------------------------------
-// Method: getDictionary
-// Description: This method returns the dictionary object for the queried
-//              service or null if the dictionary does not exist. It will load
-//              the dictionary blueprint if it is not already loaded by the
-//              driver.
-//
-// Parameters: service - the dictioary to check for
-//
-// Returns: the dictionary object if it's a valid dictionary.
-//-----------------------------------------------------------------------------
-protected object getDictionary(string service)
-{
-    object ret = 0;
-    
-    if(service && stringp(service))
+    else
     {
-        string dictionary = sprintf("/lib/dictionaries/%sDictionary.c", 
-            service);
-        if(file_size(dictionary) > -1)
+        mapping services = getProgramServices();
+        if (services["realization handler"] == RealizationProgram)
         {
-            ret = load_object(dictionary);
+            ret = (service && stringp(service) &&
+                member(services["realizations"], service)) ? this_object() : 0;
+        }
+        else if (services["realization handler"])
+        {
+            ret = call_other(this_object(), "isRealizationOf", service);
         }
     }
+
     return ret;
 }
 
@@ -108,3 +197,40 @@ protected object getMessageParser()
     }
     return ret;
 }
+
+//-----------------------------------------------------------------------------
+// Method: aliasesChanged
+// Description: This method lets the environment this 'thing' is in know that
+//              the names it can be targeted by have changed so that the
+//              environment's contents index can be updated.
+//-----------------------------------------------------------------------------
+protected nomask void aliasesChanged()
+{
+    object location = environment(this_object());
+    if (location && function_exists("updateContentsIndex", location))
+    {
+        location->updateContentsIndex(this_object());
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Method: moveObject
+// Description: This method moves the passed item to the passed destination
+//              and, when the destination is an environment, lets it add the
+//              item to its contents index. The driver does not tell rooms
+//              when non-living objects arrive, so anything that moves items
+//              into a room should do it this way.
+//
+// Parameters: item - the object to move
+//             destination - the object or file to move it to
+//-----------------------------------------------------------------------------
+protected nomask void moveObject(object item, mixed destination)
+{
+    move_object(item, destination);
+
+    object location = environment(item);
+    if (location && function_exists("updateContentsIndex", location))
+    {
+        location->updateContentsIndex(item);
+    }
+}
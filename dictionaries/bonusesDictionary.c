@@ -5,7 +5,7 @@
 // Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
 //                      the accompanying LICENSE file for details.
 //*****************************************************************************
-private nosave string LibDirectory = "lib/dictionaries";
+virtual inherit "/lib/core/dictionaryAccess.c";
 
 private string *bonuses = 0;
 private mapping functionsToBonuses = ([
@@ -28,23 +28,6 @@ private mapping functionsToBonuses = ([
     "ReduceStaminaPoints": "bonus reduce stamina points"
 ]);
 
-/////////////////////////////////////////////////////////////////////////////
-private nomask object getDictionary(string service)
-{
-    object ret = 0;
-    
-    if(service && stringp(service))
-    {
-        string dictionary = sprintf("/%s/%sDictionary.c", LibDirectory,
-            service);
-        if(file_size(dictionary) > -1)
-        {
-            ret = load_object(dictionary);
-        }
-    }
-    return ret;
-}
-
 /////////////////////////////////////////////////////////////////////////////
 private nomask string *bonusList()
 {
@@ -2,14 +2,42 @@
 // Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
 //                      the accompanying LICENSE file for details.
 //*****************************************************************************
+virtual inherit "/lib/core/events.c";
 #include "/lib/dictionaries/environment/locations.h"
 
 private string BaseEnvironment = "lib/environment/environment.c";
 private string BaseElement = "lib/environment/environmentalElement.c";
+private string BaseRegion = "lib/environment/region.c";
 private string currentSeason = "summer";
 private string currentTimeOfDay = "noon";
 private mapping elementList = ([]);
 
+// Bumped whenever something that environment descriptions and light levels
+// depend on changes so that environments know to discard what they cached.
+private int environmentEpoch = 0;
+
+// Element name -> verified, set up element blueprint. Entries are resolved
+// on first use and only re-resolved once the blueprint has been destructed
+// (for example, by an update), so lookups do not touch the file system.
+private nosave mapping resolvedElements = ([]);
+
+// Region path -> verified region object.
+private nosave mapping regions = ([]);
+
+// Environment name -> serialized state of rooms that were swapped out by
+// clean_up. Entries are handed back (and removed) when the room reloads.
+private mapping swappedEnvironments = ([]);
+
+// The world clock moves on to the next time of day every
+// SecondsPerTimeOfDay seconds and to the next season once DaysPerSeason
+// days have gone by. Each transition is published as an onTimeOfDayChanged
+// or onSeasonChanged event to anything registered with registerEvent.
+// It only runs once startWorldClock has been called, which login.c does at
+// boot.
+private nosave int SecondsPerTimeOfDay = 450;
+private nosave int DaysPerSeason = 7;
+private int currentDayOfSeason = 0;
+
 private string *validSeasons = ({ "winter", "spring", "summer", "autumn" });
 private string *validTimesOfDay = ({ "midnight", "night", "dawn", "morning", "noon", "afternoon", "evening", "dusk" });
 
@@ -67,21 +95,58 @@ public nomask object getEnvironment(string location)
 }
 
 /////////////////////////////////////////////////////////////////////////////
-public nomask object environmentalObject(string element)
+private nomask object loadElement(string location)
 {
     object ret = 0;
 
-    if (element && stringp(element) && member(elementList, element) &&
-        (file_size(elementList[element]) > 0))
+    if (file_size(location) > 0)
     {
-        ret = load_object(elementList[element]);
-        if (member(inherit_list(ret), BaseElement) < 0)
+        ret = load_object(location);
+        if (ret && (member(inherit_list(ret), BaseElement) > -1))
         {
-            ret = 0;
+            // Elements run Setup as part of their own reset. It is only
+            // called here if that did not happen.
+            if (!ret->Name())
+            {
+                ret->Setup();
+            }
         }
         else
         {
-            ret->Setup();
+            ret = 0;
+        }
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask object environmentalObject(string element)
+{
+    object ret = 0;
+
+    if (element && stringp(element) && member(elementList, element))
+    {
+        ret = resolvedElements[element];
+        if (!objectp(ret))
+        {
+            int wasResolved = member(resolvedElements, element);
+            ret = loadElement(elementList[element]);
+
+            if (ret)
+            {
+                resolvedElements[element] = ret;
+
+                // A blueprint that was updated may describe itself
+                // differently, so cached descriptions are no longer valid.
+                if (wasResolved)
+                {
+                    environmentEpoch++;
+                }
+            }
+            else
+            {
+                m_delete(resolvedElements, element);
+            }
         }
     }
     return ret;
@@ -113,17 +178,15 @@ public nomask varargs int registerElement(string location, string type)
         location = "/" + location;
     }
 
-    if (file_size(location) > 0)
+    object element = loadElement(location);
+    if (element)
     {
-        object element = load_object(location);
-        element->Setup();
-
-        if (element && objectp(element) &&
-            (member(inherit_list(element), BaseElement) > -1) &&
-            element->Name() && !member(elementList, element->Name()))
+        if (element->Name() && !member(elementList, element->Name()))
         {
             ret = 1;
             elementList[element->Name()] = location;
+            resolvedElements[element->Name()] = element;
+            environmentEpoch++;
 
             if (type && stringp(type) &&
                 (element->Type() != type))
@@ -141,6 +204,31 @@ public nomask varargs int registerElement(string location, string type)
     return ret;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+public nomask void storeEnvironmentState(string data)
+{
+    object environment = previous_object();
+    if (environment && !clonep(environment) && stringp(data) &&
+        (member(inherit_list(environment), BaseEnvironment) > -1))
+    {
+        swappedEnvironments[object_name(environment)] = data;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask string retrieveEnvironmentState()
+{
+    string ret = 0;
+    string environment = object_name(previous_object());
+
+    if (member(swappedEnvironments, environment))
+    {
+        ret = swappedEnvironments[environment];
+        m_delete(swappedEnvironments, environment);
+    }
+    return ret;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 public nomask int canMakeMove(object user, object fromLocation, object toLocation)
 {
@@ -187,9 +275,17 @@ public nomask string timeOfDay(string newTime)
 {
     string ret = 0;
     if (newTime && stringp(newTime) &&
-        (member(validTimesOfDay, newTime) > -1))
+        (member(validTimesOfDay, newTime) > -1) &&
+        (newTime != currentTimeOfDay))
     {
+        string previousTimeOfDay = currentTimeOfDay;
         currentTimeOfDay = newTime;
+        environmentEpoch++;
+
+        notifySynchronous("onTimeOfDayChanged", ([
+            "previous": previousTimeOfDay,
+            "current": currentTimeOfDay
+        ]));
     }
     return currentTimeOfDay;
 }
@@ -199,13 +295,85 @@ public nomask string season(string newSeason)
 {
     string ret = 0;
     if (newSeason && stringp(newSeason) && 
-        (member(validSeasons, newSeason) > -1))
+        (member(validSeasons, newSeason) > -1) &&
+        (newSeason != currentSeason))
     {
+        string previousSeason = currentSeason;
         currentSeason = newSeason;
+        environmentEpoch++;
+
+        notifySynchronous("onSeasonChanged", ([
+            "previous": previousSeason,
+            "current": currentSeason
+        ]));
     }
     return currentSeason;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+public nomask int dayOfSeason()
+{
+    return currentDayOfSeason;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void advanceWorldClock()
+{
+    int nextTimeOfDay = (member(validTimesOfDay, currentTimeOfDay) + 1) %
+        sizeof(validTimesOfDay);
+
+    // The season changes before the time of day so that subscribers to
+    // the new day see the new season.
+    if (!nextTimeOfDay)
+    {
+        currentDayOfSeason++;
+        if (currentDayOfSeason >= DaysPerSeason)
+        {
+            currentDayOfSeason = 0;
+            season(validSeasons[(member(validSeasons, currentSeason) + 1) %
+                sizeof(validSeasons)]);
+        }
+    }
+    timeOfDay(validTimesOfDay[nextTimeOfDay]);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+static nomask void worldClockTick()
+{
+    call_out("worldClockTick", SecondsPerTimeOfDay);
+    advanceWorldClock();
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask int startWorldClock()
+{
+    int ret = 0;
+    if (find_call_out("worldClockTick") < 0)
+    {
+        call_out("worldClockTick", SecondsPerTimeOfDay);
+        ret = 1;
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask int stopWorldClock()
+{
+    return remove_call_out("worldClockTick") > -1;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask int worldClockIsRunning()
+{
+    return find_call_out("worldClockTick") > -1;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask int descriptionEpoch()
+{
+    return environmentEpoch;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 public nomask string *timesOfDay()
 {
@@ -237,13 +405,46 @@ public nomask string convertNumberToString(int number)
 }
 
 /////////////////////////////////////////////////////////////////////////////
-public nomask int coordinatesValidForRegion(string region, int x, int y)
+public nomask object getRegion(string region)
 {
-    return 0;
+    object ret = 0;
+
+    if (region && stringp(region) && sizeof(region))
+    {
+        if (region[0] != '/')
+        {
+            region = "/" + region;
+        }
+
+        ret = regions[region];
+        if (!objectp(ret))
+        {
+            ret = 0;
+            if (file_size(region) > 0)
+            {
+                ret = load_object(region);
+                if (!ret || (member(inherit_list(ret), BaseRegion) < 0))
+                {
+                    ret = 0;
+                }
+            }
+
+            if (ret)
+            {
+                regions[region] = ret;
+            }
+            else
+            {
+                m_delete(regions, region);
+            }
+        }
+    }
+    return ret;
 }
 
 /////////////////////////////////////////////////////////////////////////////
-public nomask object getRegion(string region)
+public nomask int coordinatesValidForRegion(string region, int x, int y)
 {
-    return 0;
+    object regionObj = getRegion(region);
+    return regionObj && regionObj->isValidCoordinate(x, y);
 }
@@ -0,0 +1,281 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+private string BaseEnvironment = "lib/environment/environment.c";
+
+// The room graph. Rooms add themselves (and update their entry) as they
+// load, add exits or change state. Rooms that are referenced by an exit
+// but have never been loaded are leaves until they are - routing never
+// loads a room. Cloned rooms are keyed by their object name and dropped
+// once they have been destructed since nothing can load them again.
+//   room -> ([ direction: destination room ])
+private mapping exitGraph = ([]);
+
+// landmark name -> room
+private mapping landmarks = ([]);
+
+// "from::to" -> ({ directions }) and the "from::to" pairs with no route.
+// Each search also records every room it reached before it finished: a
+// change to a room's exits can only alter the routes whose search reached
+// that room, so only those are thrown away.
+//   room -> ([ "from::to" ]) and "from::to" -> ({ rooms reached })
+private nosave mapping routes = ([]);
+private nosave mapping unreachable = ([]);
+private nosave mapping routesByRoom = ([]);
+private nosave mapping roomsByRoute = ([]);
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask string roomKey(mixed room)
+{
+    string ret = 0;
+
+    if (objectp(room))
+    {
+        ret = object_name(room);
+    }
+    else if (stringp(room) && sizeof(room))
+    {
+        ret = room;
+    }
+
+    if (ret)
+    {
+        if (ret[0] != '/')
+        {
+            ret = "/" + ret;
+        }
+        if ((sizeof(ret) > 2) && (ret[<2..] == ".c"))
+        {
+            ret = ret[0..<3];
+        }
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int exitsChanged(string room, mapping exits)
+{
+    int ret = !member(exitGraph, room) ||
+        (sizeof(exitGraph[room]) != sizeof(exits));
+
+    if (!ret)
+    {
+        foreach(string direction in m_indices(exits))
+        {
+            ret ||= (exitGraph[room][direction] != exits[direction]);
+        }
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void forgetRoute(string key)
+{
+    if (member(roomsByRoute, key))
+    {
+        foreach(string room in roomsByRoute[key])
+        {
+            if (member(routesByRoom, room))
+            {
+                m_delete(routesByRoom[room], key);
+                if (!sizeof(routesByRoom[room]))
+                {
+                    m_delete(routesByRoom, room);
+                }
+            }
+        }
+        m_delete(roomsByRoute, key);
+    }
+    m_delete(routes, key);
+    m_delete(unreachable, key);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void roomChanged(string room)
+{
+    if (member(routesByRoom, room))
+    {
+        foreach(string key in m_indices(routesByRoom[room]))
+        {
+            forgetRoute(key);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void rememberRoute(string key, string *route, string *reached)
+{
+    if (route)
+    {
+        routes[key] = route;
+    }
+    else
+    {
+        unreachable[key] = 1;
+    }
+
+    roomsByRoute[key] = reached;
+    foreach(string room in reached)
+    {
+        if (!member(routesByRoom, room))
+        {
+            routesByRoom[room] = ([]);
+        }
+        routesByRoom[room][key] = 1;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void removeRoom(string room)
+{
+    m_delete(exitGraph, room);
+    roomChanged(room);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int isDestructedClone(string room)
+{
+    return (member(room, '#') > -1) && !find_object(room);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void registerRoom(object room)
+{
+    if (objectp(room) &&
+        (member(inherit_list(room), BaseEnvironment) > -1))
+    {
+        string key = roomKey(room);
+
+        mapping exits = ([]);
+        mapping destinations = room->exitDestinations();
+        foreach(string direction in m_indices(destinations))
+        {
+            exits[direction] = roomKey(destinations[direction]);
+        }
+
+        if (exitsChanged(key, exits))
+        {
+            exitGraph[key] = exits;
+            roomChanged(key);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask mapping exitsFrom(mixed room)
+{
+    string key = roomKey(room);
+    if (key && member(exitGraph, key) && isDestructedClone(key))
+    {
+        removeRoom(key);
+    }
+    else if (key && !member(exitGraph, key) && find_object(key))
+    {
+        registerRoom(find_object(key));
+    }
+    return (key && member(exitGraph, key)) ? exitGraph[key] + ([]) : ([]);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void registerLandmark(string name, mixed room)
+{
+    if (stringp(name) && roomKey(room))
+    {
+        landmarks[name] = roomKey(room);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask string landmarkLocation(string name)
+{
+    return member(landmarks, name) ? landmarks[name] : 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask string *findRoute(string start, string goal, mapping reached)
+{
+    // Every exit costs the same, so a breadth-first search finds a shortest
+    // route. Exits are taken in alphabetical order so that the same route
+    // is chosen among equally short ones.
+    string *ret = 0;
+
+    mapping cameFrom = ([ start: 0 ]);
+    string *frontier = ({ start });
+    reached[start] = 1;
+
+    while (sizeof(frontier) && !ret)
+    {
+        string current = frontier[0];
+        frontier = frontier[1..];
+
+        if (current == goal)
+        {
+            ret = ({});
+            while (current != start)
+            {
+                ret = ({ cameFrom[current][1] }) + ret;
+                current = cameFrom[current][0];
+            }
+        }
+        else
+        {
+            mapping exits = exitsFrom(current);
+            foreach(string direction in sort_array(m_indices(exits),
+                (: $1 > $2 :)))
+            {
+                string next = exits[direction];
+                if (!member(cameFrom, next))
+                {
+                    cameFrom[next] = ({ current, direction });
+                    frontier += ({ next });
+                    reached[next] = 1;
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask string *getRoute(mixed from, mixed to)
+{
+    string *ret = 0;
+    string start = roomKey(from);
+    string goal = roomKey(to);
+
+    if (start && goal)
+    {
+        string key = start + "::" + goal;
+        if (member(routes, key))
+        {
+            ret = routes[key];
+        }
+        else if (!member(unreachable, key))
+        {
+            mapping reached = ([]);
+            ret = findRoute(start, goal, reached);
+            rememberRoute(key, ret, m_indices(reached));
+        }
+    }
+    return ret ? ret + ({}) : 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask string nextStep(mixed from, mixed to)
+{
+    string *route = getRoute(from, to);
+    return sizeof(route) ? route[0] : 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public void reset(int arg)
+{
+    // Cloned rooms have no clean_up of their own that could tell the graph
+    // they are gone, so any that have been destructed are swept up here.
+    foreach(string room in filter(m_indices(exitGraph + routesByRoom),
+        #'isDestructedClone))
+    {
+        removeRoom(room);
+    }
+}
@@ -6,32 +6,14 @@
 //                      the accompanying LICENSE file for details.
 //*****************************************************************************
 
-private string BaseResearch = "lib/modules/research/researchItem.c";
-private string BaseResearchTree = "lib/modules/research/researchTree.c";
+private nosave string ObjectRegistry = "/lib/core/objectRegistry.c";
 
 /////////////////////////////////////////////////////////////////////////////
 public nomask object researchObject(string researchItem)
 {
     // The passed in value for researchItem must be a file containing a valid
-    // researchItem object.
-    object ret = 0;
-
-    if (researchItem && stringp(researchItem) && researchItem[0] != '/')
-    {
-        researchItem = regreplace(researchItem, " ", "_", 1);
-        researchItem = "/" + researchItem;
-    }
-    if(researchItem && stringp(researchItem) && (file_size(researchItem) > 0))
-    { 
-        ret = load_object(researchItem);
-
-        if(!ret || (member(inherit_list(ret), BaseResearch) < 0) ||
-           !ret->isValidResearchItem())
-        {
-            ret = 0;
-        }
-    }
-    return ret;
+    // researchItem object. The registry only resolves and validates it once.
+    return load_object(ObjectRegistry)->getObject("research", researchItem);
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -39,24 +21,7 @@ public nomask object researchTree(string tree)
 {
     // The passed in value for tree must be a file containing a valid
     // researchTree object.
-    object ret = 0;
-
-    if (tree && stringp(tree) && tree[0] != '/')
-    {
-    tree = regreplace(tree, " ", "_", 1);
-        tree = "/" + tree;
-    }
-
-    if(tree && stringp(tree) && (file_size(tree) > 0))
-    {
-        ret = load_object(tree);
-
-        if(member(inherit_list(ret), BaseResearchTree) < 0)
-        {
-            ret = 0;
-        }
-    }
-    return ret;
+    return load_object(ObjectRegistry)->getObject("research tree", tree);
 }
 
 /////////////////////////////////////////////////////////////////////////////
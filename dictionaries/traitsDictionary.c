@@ -8,6 +8,7 @@
 #include "/lib/include/itemFormatters.h"
 
 private string BaseTrait = "lib/modules/traits/baseTrait.c";
+private nosave string ObjectRegistry = "/lib/core/objectRegistry.c";
 private string *validTraitTypes = ({ "health", "educational", "personality", 
     "genetic", "professional", "guild", "role", "effect", "sustained effect",
     "background", "racial", "persona" });
@@ -16,31 +17,74 @@ private mapping traits = ([]);
 
 private nosave string FieldDisplay = Cyan + ": " + Value + "\n";
 
+// trait -> ([ "trait object", "root", "opposing root", "type", "opinion",
+//             "opposing opinion" ])
+// An entry is rebuilt if its trait object has been destructed (or updated).
+private nosave mapping traitClassifications = ([]);
+
 /////////////////////////////////////////////////////////////////////////////
 public nomask object traitObject(string trait)
 {
     // The passed in value for trait must be a file containing a valid
-    // trait object.
-    object ret = 0;
+    // trait object. The registry only resolves and validates it once.
+    return load_object(ObjectRegistry)->getObject("trait", trait);
+}
 
-    if (trait && stringp(trait) && trait[0] != '/')
-    {
-        trait = "/" + trait;
-    }
+/////////////////////////////////////////////////////////////////////////////
+public nomask mapping traitClassification(string trait)
+{
+    mapping ret = 0;
 
-    if(trait && stringp(trait) && (file_size(trait) > 0))
-    { 
-        ret = load_object(trait);
+    if (trait && stringp(trait))
+    {
+        if (!member(traitClassifications, trait) ||
+            !objectp(traitClassifications[trait]["trait object"]))
+        {
+            object traitObj = traitObject(trait);
+            if (traitObj)
+            {
+                traitClassifications[trait] = ([
+                    "trait object": traitObj,
+                    "root": traitObj->query("root"),
+                    "opposing root": traitObj->query("opposing root"),
+                    "type": traitObj->query("type"),
+                    "opinion": traitObj->query("opinion"),
+                    "opposing opinion": traitObj->query("opposing opinion")
+                ]);
+            }
+            else
+            {
+                m_delete(traitClassifications, trait);
+            }
+        }
 
-        if(!ret || (member(inherit_list(ret), BaseTrait) < 0) ||
-           !ret->isValidTrait())
+        if (member(traitClassifications, trait))
         {
-            ret = 0;
+            ret = traitClassifications[trait] + ([]);
+            m_delete(ret, "trait object");
         }
     }
     return ret;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+public nomask mapping traitOpinionAffinity(string trait)
+{
+    // A trait with both a root and an opposing root changes its owner's
+    // opinion of anyone with a trait of either root.
+    mapping ret = ([]);
+    mapping classification = traitClassification(trait);
+
+    if (classification && classification["root"] &&
+        classification["opposing root"])
+    {
+        ret[classification["opposing root"]] = 
+            classification["opposing opinion"];
+        ret[classification["root"]] = classification["opinion"];
+    }
+    return ret;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 public nomask int traitIsRegistered(string trait)
 {
@@ -85,15 +129,15 @@ public nomask int isValidTraitType(string type)
 /////////////////////////////////////////////////////////////////////////////
 public nomask int traitIsOfType(string trait, string type)
 {
-    object traitObj = traitObject(trait);
-    return (traitObj && objectp(traitObj) && (traitObj->query("type") == type));
+    mapping classification = traitClassification(trait);
+    return (classification && (classification["type"] == type));
 }
 
 /////////////////////////////////////////////////////////////////////////////
 public nomask int traitIsOfRoot(string trait, string root)
 {
-    object traitObj = traitObject(trait);
-    return (traitObj && objectp(traitObj) && (traitObj->query("root") == root));
+    mapping classification = traitClassification(trait);
+    return (classification && (classification["root"] == root));
 }
 
 /////////////////////////////////////////////////////////////////////////////
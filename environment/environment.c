@@ -30,12 +30,44 @@ private nosave object StateMachine = 0;
 private nosave string BaseStateMachine = "lib/core/stateMachine.c";
 private nosave int SetupCompleted = 0;
 
+// The layout of long() per state - which terrain / interior and elements
+// are described, the directions they are seen in and the additional
+// description. The elements themselves are rendered on every look. The
+// light level is cached per state. Both are thrown away whenever the state
+// or the environment's elements change, and the light levels also whenever
+// the environment dictionary reports that the season, time of day or
+// registered elements have changed.
+private nosave mapping descriptionCache = ([]);
+private nosave mapping lightLevels = ([]);
+private nosave object dictionarySource = 0;
+private nosave int dictionaryEpoch = -1;
+
+// Alias -> ({ objects }) for the environment's contents and the aliases
+// each object was indexed under. Objects whose id() is not the standard
+// item or living one are stored with 0 aliases, are kept in
+// customIdContents and are checked with id() just like present() would.
+// Livings are indexed by init() when they arrive, everything else by
+// whatever moved it here calling updateContentsIndex or, failing that, by
+// the first lookup that misses. Objects that have left are dropped when a
+// lookup finds them somewhere else.
+private nosave mapping contentsIndex = ([]);
+private nosave mapping indexedContents = ([]);
+private nosave object *customIdContents = ({});
+private nosave string *IndexablePrograms = ({ "lib/items/item.c",
+    "lib/modules/materialAttributes.c" });
+
 /////////////////////////////////////////////////////////////////////////////
 private object environmentDictionary()
 {
     return load_object("/lib/dictionaries/environmentDictionary.c");
 }
 
+/////////////////////////////////////////////////////////////////////////////
+private object navigationDictionary()
+{
+    return load_object("/lib/dictionaries/navigationDictionary.c");
+}
+
 /////////////////////////////////////////////////////////////////////////////
 public nomask varargs string currentState(string newState)
 {
@@ -46,6 +78,41 @@ public nomask varargs string currentState(string newState)
     return State;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+private nomask string normalizeProgramName(string file)
+{
+    if (file && sizeof(file) && (file[0] == '/'))
+    {
+        file = file[1..];
+    }
+    if (file && ((sizeof(file) < 2) || (file[<2..] != ".c")))
+    {
+        file += ".c";
+    }
+    return file;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void invalidateCaches()
+{
+    descriptionCache = ([]);
+    lightLevels = ([]);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask object synchronizedDictionary()
+{
+    object dictionary = environmentDictionary();
+    if ((dictionary != dictionarySource) ||
+        (dictionary->descriptionEpoch() != dictionaryEpoch))
+    {
+        invalidateCaches();
+        dictionarySource = dictionary;
+        dictionaryEpoch = dictionary->descriptionEpoch();
+    }
+    return dictionary;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 public nomask varargs void setStateMachine(object newSM)
 {
@@ -136,6 +203,7 @@ private nomask void createStateObjects()
                 StateMachine->registerStateActor(stateObject);
             }
             move_object(stateObject, this_object());
+            updateContentsIndex(stateObject);
         }
     }
 }
@@ -198,6 +266,7 @@ private nomask varargs int addEnvironmentalElement(string element, string type,
             m_indices(mkmapping(environmentalElements[type][element] +
                 ({ getLocation(location) }) - ({ 0 })));
         setUpAliases(element);
+        invalidateCaches();
     }
     return ret;
 }
@@ -314,6 +383,31 @@ protected nomask varargs void addExit(string direction, string path, string stat
         exits[state] = ([]);
     }
     exits[state][direction] = path;
+    navigationDictionary()->registerRoom(this_object());
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask mapping exitDestinations()
+{
+    mapping ret = member(exits, "default") ? exits["default"] + ([]) : ([]);
+    if ((currentState() != "default") && member(exits, currentState()))
+    {
+        ret += exits[currentState()];
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+protected nomask void addLandmark(string name)
+{
+    if (stringp(name) && sizeof(name))
+    {
+        navigationDictionary()->registerLandmark(name, this_object());
+    }
+    else
+    {
+        raise_error("ERROR in environment.c: A landmark must have a name.\n");
+    }
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -373,6 +467,13 @@ protected nomask void setCoordinates(string region, int x, int y)
         RegionPath = region;
         xCoordinate = x;
         yCoordinate = y;
+        // Clones share their blueprint's coordinates, so only the blueprint
+        // is placed on the region's map.
+        if (!clonep(this_object()))
+        {
+            environmentDictionary()->getRegion(region)->registerRoom(x, y,
+                program_name(this_object()));
+        }
     }
     else
     {
@@ -393,6 +494,7 @@ protected nomask varargs void setAdditionalLongDescription(
     if (stringp(description))
     {
         environmentalElements["description"][state] = description;
+        invalidateCaches();
     }
     else
     {
@@ -463,9 +565,9 @@ private nomask string parseEfunCall(string match)
 }
 
 /////////////////////////////////////////////////////////////////////////////
-private string getElementDescriptions(string type)
+private mixed *getElementLayout(string type)
 {
-    string ret = "";
+    mixed *ret = ({});
 
     if (member(environmentalElements, type) &&
         sizeof(environmentalElements[type]))
@@ -488,36 +590,19 @@ private string getElementDescriptions(string type)
                         (: $1 > $2 :)), ", ");
                 directions = regreplace(directions, ",([^,]+)$", " and\\1");
             }
-
-            object elementObj = 
-                environmentDictionary()->environmentalObject(element);
-            if (elementObj)
-            {
-                ret += directions + " you see " +
-                    elementObj->description(currentState()) + ".";
-            }
+            ret += ({ ({ type, element, directions }) });
         }
     }
     return ret;
 }
 
 /////////////////////////////////////////////////////////////////////////////
-private string getBaseDescriptionForType(string type)
+private mixed *getBaseLayoutForType(string type)
 {
-    string ret = 0;
+    mixed *ret = 0;
     if (member(environmentalElements, type) && sizeof(environmentalElements[type]))
     {
-        string element = m_indices(environmentalElements[type])[0];
-        object base = environmentDictionary()->environmentalObject(element);
-        if (base)
-        {
-            ret = base->description(currentState());
-        }
-        else
-        {
-            raise_error(sprintf("ERROR in environment.c: Failed to load "
-                "%s '%s'.\n", type, element));
-        }
+        ret = ({ ({ type, m_indices(environmentalElements[type])[0], 0 }) });
     }
     return ret;
 }
@@ -582,37 +667,245 @@ public void setShortDescription(string newShort)
 }
 
 /////////////////////////////////////////////////////////////////////////////
-public varargs string long(string item)
+private nomask mixed *getDescriptionLayout()
 {
-    string ret = getBaseDescriptionForType("terrain");
-    if (!ret)
+    string state = currentState();
+
+    if (!member(descriptionCache, state))
     {
-        ret = getBaseDescriptionForType("interior");
+        mixed *layout = getBaseLayoutForType("terrain");
+        if (!layout)
+        {
+            layout = getBaseLayoutForType("interior");
+        }
+
+        if (!layout)
+        {
+            raise_error("ERROR in environment.c: Either a valid terrain or "
+                "interior must be set.\n");
+        }
+
+        layout += getElementLayout("feature") + 
+            getElementLayout("item") + 
+            getElementLayout("building");
+
+        if (member(environmentalElements["description"], state))
+        {
+            layout += ({ " " + environmentalElements["description"][state] });
+        }
+        descriptionCache[state] = layout;
     }
+    return descriptionCache[state];
+}
 
-    if (ret)
-    {
-        ret += getElementDescriptions("feature") + 
-            getElementDescriptions("item") + 
-            getElementDescriptions("building");
+/////////////////////////////////////////////////////////////////////////////
+private nomask string renderDescription()
+{
+    string ret = "";
 
-        if (member(environmentalElements["description"], currentState()))
+    foreach(mixed part in getDescriptionLayout())
+    {
+        if (stringp(part))
+        {
+            ret += part;
+        }
+        else
         {
-            ret += " " + environmentalElements["description"][currentState()];
+            object elementObj =
+                environmentDictionary()->environmentalObject(part[1]);
+
+            if (stringp(part[2]))
+            {
+                if (elementObj)
+                {
+                    ret += part[2] + " you see " +
+                        elementObj->description(currentState()) + ".";
+                }
+            }
+            else if (elementObj)
+            {
+                ret += elementObj->description(currentState());
+            }
+            else
+            {
+                raise_error(sprintf("ERROR in environment.c: Failed to load "
+                    "%s '%s'.\n", part[0], part[1]));
+            }
         }
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public varargs string long(string item)
+{
+    // Element descriptions pick their adjectives and season / time of day
+    // segments at random, so only the layout is cached and the elements
+    // are rendered on every look. Most rooms (converted legacy rooms
+    // included) have no ##call_other segments at all, so the regular
+    // expression is skipped for them.
+    string ret = renderDescription();
+    if (strstr(ret, "##") > -1)
+    {
         ret = regreplace(ret,
             "##([^:]+)::(key|filename|room)::([^:]+)::([a-zA-Z0-9_])+",
             #'parseEfunCall,1);
     }
-    else
-    {
-        raise_error("ERROR in environment.c: Either a valid terrain or "
-            "interior must be set.\n");
-    }
+
     return format(sprintf(Description, capitalizeSentences(ret)), 78) + 
         getExitDescription() + getInventoryDescription();
 }
 
+/////////////////////////////////////////////////////////////////////////////
+private nomask void unindexContent(object item)
+{
+    if (member(indexedContents, item))
+    {
+        foreach(string alias in (indexedContents[item] || ({})))
+        {
+            if (member(contentsIndex, alias))
+            {
+                contentsIndex[alias] -= ({ item });
+                if (!sizeof(contentsIndex[alias]))
+                {
+                    m_delete(contentsIndex, alias);
+                }
+            }
+        }
+        m_delete(indexedContents, item);
+        customIdContents -= ({ item });
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void indexContent(object item)
+{
+    string *aliases = 0;
+
+    string idProgram = function_exists("id", item);
+    if (idProgram && (member(IndexablePrograms,
+        normalizeProgramName(idProgram)) > -1))
+    {
+        aliases = m_indices(mkmapping(item->targetAliases() - ({ 0 })));
+        foreach(string alias in aliases)
+        {
+            contentsIndex[alias] = (member(contentsIndex, alias) ?
+                contentsIndex[alias] : ({})) + ({ item });
+        }
+    }
+    else if (idProgram)
+    {
+        customIdContents += ({ item });
+    }
+    indexedContents[item] = aliases;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void updateContentsIndex(object item)
+{
+    if (objectp(item))
+    {
+        unindexContent(item);
+        if (environment(item) == this_object())
+        {
+            indexContent(item);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask object *presentContents(object *candidates)
+{
+    // Returns the candidates that are still here, forgetting the ones that
+    // have been destructed or moved elsewhere.
+    object *ret = ({});
+    foreach(object item in candidates)
+    {
+        if (objectp(item) && (environment(item) == this_object()))
+        {
+            ret += ({ item });
+        }
+        else if (item)
+        {
+            unindexContent(item);
+        }
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask object *indexedMatches(string target, int n)
+{
+    object *ret = ({});
+    if (member(contentsIndex, target))
+    {
+        ret = presentContents(contentsIndex[target]);
+        if (sizeof(ret))
+        {
+            contentsIndex[target] = ret;
+        }
+        else
+        {
+            m_delete(contentsIndex, target);
+        }
+    }
+
+    if (sizeof(ret) < n)
+    {
+        customIdContents = presentContents(customIdContents);
+        ret += filter(customIdContents, (: $1->id($2) :), target);
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask varargs object findInRoom(string target, int n)
+{
+    object ret = 0;
+
+    if (target && stringp(target))
+    {
+        // Like present(), "sword 2" is the second sword.
+        string *words = explode(target, " ");
+        if (!n && (sizeof(words) > 1) &&
+            (to_string(to_int(words[<1])) == words[<1]))
+        {
+            n = to_int(words[<1]);
+            target = implode(words[0..<2], " ");
+        }
+        if (n < 1)
+        {
+            n = 1;
+        }
+
+        object *matches = indexedMatches(target, n);
+
+        // Anything moved here with a bare move_object() was never indexed,
+        // so a miss falls back to checking the room's inventory like
+        // present() does, indexing whatever had been missed.
+        if (sizeof(matches) < n)
+        {
+            object *unindexed = filter(all_inventory(),
+                (: !member(indexedContents, $1) :));
+
+            if (sizeof(unindexed))
+            {
+                foreach(object item in unindexed)
+                {
+                    indexContent(item);
+                }
+                matches = indexedMatches(target, n);
+            }
+        }
+
+        if (sizeof(matches) >= n)
+        {
+            ret = matches[n - 1];
+        }
+    }
+    return ret;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 public nomask int isEnvironmentalElement(string item)
 {
@@ -682,6 +975,7 @@ public void init()
     if (this_player())
     {
         remove_action(1);
+        updateContentsIndex(this_player());
     }
     string *directions = ({});
     if (member(exits, currentState()) && sizeof(exits[currentState()]))
@@ -708,6 +1002,131 @@ public void Setup()
 {
 }
 
+/////////////////////////////////////////////////////////////////////////////
+private nomask int isStateObject(object item)
+{
+    string *stateObjects = ({});
+    foreach(string state in ({ "default", currentState() }))
+    {
+        if (member(environmentalElements["objects"], state))
+        {
+            stateObjects += map(environmentalElements["objects"][state],
+                #'normalizeProgramName);
+        }
+    }
+    return member(stateObjects, program_name(item)) > -1;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask string serializeSwappedState()
+{
+    // State objects are recreated by reset, so only the state, the shop's
+    // inventory and items that were brought here need to be kept. Anything
+    // that cannot be rebuilt from its blueprint and delta - players,
+    // monsters, containers with contents - keeps the room loaded.
+    string ret = 0;
+    int canSwap = 1;
+    mapping data = ([ "state": currentState(), "objects": ({}) ]);
+
+    foreach(object item in all_inventory(this_object()))
+    {
+        if (!isStateObject(item))
+        {
+            canSwap &&= !living(item) && !interactive(item) &&
+                !sizeof(all_inventory(item)) &&
+                (member(inherit_list(item), "lib/items/item.c") > -1);
+
+            if (canSwap)
+            {
+                data["objects"] += ({ ({ program_name(item),
+                    item->query("delta") }) });
+            }
+        }
+    }
+
+    if (canSwap)
+    {
+        if (objectp(getShop()))
+        {
+            data["shop"] = getShop()->storeInventory();
+        }
+        ret = save_value(data);
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void restoreSwappedState()
+{
+    string swappedState = environmentDictionary()->retrieveEnvironmentState();
+    if (swappedState)
+    {
+        mapping data = restore_value(swappedState);
+
+        // The room stopped listening to its state machine when it was
+        // swapped out, so the state machine - not the snapshot - knows
+        // which state the room is in now.
+        string state = objectp(StateMachine) ?
+            StateMachine->getCurrentState() : 0;
+        currentState(state || data["state"]);
+
+        if (objectp(getShop()) && member(data, "shop"))
+        {
+            getShop()->resetInventory();
+            getShop()->restoreInventory(data["shop"]);
+        }
+
+        foreach(mixed *item in data["objects"])
+        {
+            object itemObj = clone_object(item[0]);
+            itemObj->set("delta", item[1]);
+            move_object(itemObj, this_object());
+            updateContentsIndex(itemObj);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public int clean_up(int references)
+{
+    // Called by the driver once the room has been idle for a while. Rooms
+    // that can be rebuilt are swapped out: their state is handed to the
+    // environment dictionary and restored when the room is next loaded.
+    // Anything with more references than the driver's own is still being
+    // used (or inherited) and is kept.
+    int ret = 1;
+
+    if (!clonep(this_object()) && (references <= 1))
+    {
+        string swappedState = serializeSwappedState();
+        if (swappedState)
+        {
+            environmentDictionary()->storeEnvironmentState(swappedState);
+
+            foreach(object item in all_inventory(this_object()))
+            {
+                if (StateMachine)
+                {
+                    StateMachine->unregisterStateActor(item);
+                }
+                destruct(item);
+            }
+
+            if (objectp(getShop()))
+            {
+                destruct(getShop());
+            }
+            if (StateMachine)
+            {
+                StateMachine->unregisterStateActor(this_object());
+            }
+            destruct(this_object());
+            ret = 0;
+        }
+    }
+    return ret;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 public void reset(int arg)
 {
@@ -724,6 +1143,11 @@ public void reset(int arg)
         {
             shopObj->updateShopInventory();
         }
+
+        if (!clonep(this_object()))
+        {
+            restoreSwappedState();
+        }
     }
     createStateObjects();
 }
@@ -747,8 +1171,10 @@ public nomask void onStateChanged(object caller, string newState)
     {
         pruneStateObjects();
         currentState(newState);
+        invalidateCaches();
         init();
         createStateObjects();
+        navigationDictionary()->registerRoom(this_object());
     }
 }
 
@@ -789,15 +1215,26 @@ protected int alwaysLight()
 /////////////////////////////////////////////////////////////////////////////
 public nomask int isIlluminated()
 {
-    int ret = sizeof(environmentalElements["terrain"]) &&
-        environmentDictionary()->sunlightIsVisible();
-
-    int hasLight = getElementLighting();
-    if (hasLight > ret)
+    object dictionary = synchronizedDictionary();
+    if (!member(lightLevels, currentState()))
     {
-        ret = hasLight;
+        int ret = sizeof(environmentalElements["terrain"]) &&
+            dictionary->sunlightIsVisible();
+
+        int hasLight = getElementLighting();
+        if (hasLight > ret)
+        {
+            ret = hasLight;
+        }
+        lightLevels[currentState()] = ret;
     }
-    return ret || alwaysLight();
+    return lightLevels[currentState()] || alwaysLight();
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask mixed *coordinates()
+{
+    return RegionPath ? ({ RegionPath, xCoordinate, yCoordinate }) : 0;
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -8,6 +8,9 @@ protected int isLegacy = 0;
 private string elementName = 0;
 private string State = "default";
 
+// state -> ([ template type: ([ "season::time of day": compiled template ]) ])
+private nosave mapping compiledTemplates = ([]);
+
 /////////////////////////////////////////////////////////////////////////////
 protected object environmentDictionary()
 {
@@ -86,91 +89,103 @@ public nomask void reset(int arg)
 }
 
 /////////////////////////////////////////////////////////////////////////////
-private nomask string parseSeasonDescription(string message, mapping data)
+protected int suppressEntryMessage()
 {
-    string ret = message;
-    string season = environmentDictionary()->season();
-    if (member(data, season) && environmentDictionary()->sunlightIsVisible())
-    {
-        ret += data[season][random(sizeof(data[season]))];
-    }
-    return ret;
+    return 0;
 }
 
 /////////////////////////////////////////////////////////////////////////////
-private nomask string parseTimeOfDayDetails(string message, mapping data)
+protected int displayWeatherDetails()
 {
-    string ret = message;
-    string season = environmentDictionary()->season();
-    string timeOfDay = environmentDictionary()->timeOfDay();
-    if (member(data, timeOfDay) && member(data[timeOfDay], season))
-    {
-        ret += data[timeOfDay][season][random(sizeof(data[timeOfDay][season]))];
-    }
-    return ret;
+    return 0;
 }
 
 /////////////////////////////////////////////////////////////////////////////
-private nomask string parseWeatherDetails(string message, mapping data)
+protected int displayEntryMessage()
 {
-    return message;
+    return 0;
 }
 
 /////////////////////////////////////////////////////////////////////////////
-protected int suppressEntryMessage()
+private nomask void invalidateCompiledTemplates(string state)
 {
-    return 0;
+    m_delete(compiledTemplates, state);
 }
 
 /////////////////////////////////////////////////////////////////////////////
-private nomask string parseEntryAction(string message, mapping data)
+private nomask mixed *compileSegments(string *options)
 {
-    return suppressEntryMessage() ? "" : environmentDictionary()->getEntryMessage() + " " +
-        message + ".";
+    return map(options, (: explode($1, "##Adjective## ") :));
 }
 
 /////////////////////////////////////////////////////////////////////////////
-private nomask string parseAdjectives(string message, mapping data)
+private nomask mixed *compileTemplate(string state, string templateType,
+    string season, string timeOfDay)
 {
-    string ret = message;
+    // A compiled template is the template, the season and the time of day
+    // details split on ##Adjective## along with the adjectives that can be
+    // substituted in. Whether sunlight is visible only depends on the time
+    // of day, so it is resolved here as well.
+    mapping data = descriptionData[state];
+    int sunlightIsVisible = environmentDictionary()->sunlightIsVisible();
+
+    mixed *seasonDetails = (sunlightIsVisible && member(data, season)) ?
+        compileSegments(data[season]) : ({});
+
+    mixed *timeOfDayDetails = (member(data, timeOfDay) &&
+        member(data[timeOfDay], season)) ?
+        compileSegments(data[timeOfDay][season]) : ({});
 
-    if (member(data, "adjectives") && sizeof(data["adjectives"]) &&
-        sizeof(regexp(({ message}), "##Adjective##")))
+    string *adjectives = ({ "##Adjective## " });
+    if (member(data, "adjectives") && sizeof(data["adjectives"]))
     {
-        ret = regreplace(ret, "##Adjective## ", 
-            environmentDictionary()->sunlightIsVisible() ?
-            data["adjectives"][random(sizeof(data["adjectives"]))] + " " : "", 1);
+        adjectives = sunlightIsVisible ?
+            map(data["adjectives"], (: $1 + " " :)) : ({ "" });
     }
-    return ret;
-}
 
-/////////////////////////////////////////////////////////////////////////////
-protected int displayWeatherDetails()
-{
-    return 0;
+    return ({ explode(data[templateType], "##Adjective## "), seasonDetails,
+        timeOfDayDetails, adjectives });
 }
 
 /////////////////////////////////////////////////////////////////////////////
-protected int displayEntryMessage()
+private nomask string renderTemplate(string state, string templateType)
 {
-    return 0;
-}
+    string season = environmentDictionary()->season();
+    string timeOfDay = environmentDictionary()->timeOfDay();
+    string key = season + "::" + timeOfDay;
 
-/////////////////////////////////////////////////////////////////////////////
-protected nomask varargs string parseTemplate(string template, mapping data)
-{
-    string ret = parseSeasonDescription(template, data);
-    ret = parseTimeOfDayDetails(ret, data);
+    if (!member(compiledTemplates, state))
+    {
+        compiledTemplates[state] = ([]);
+    }
+    if (!member(compiledTemplates[state], templateType))
+    {
+        compiledTemplates[state][templateType] = ([]);
+    }
+    if (!member(compiledTemplates[state][templateType], key))
+    {
+        compiledTemplates[state][templateType][key] =
+            compileTemplate(state, templateType, season, timeOfDay);
+    }
+
+    mixed *compiled = compiledTemplates[state][templateType][key];
+    string adjective = compiled[3][random(sizeof(compiled[3]))];
 
-    if (displayWeatherDetails())
+    string ret = implode(compiled[0], adjective);
+    if (sizeof(compiled[1]))
     {
-        ret = parseWeatherDetails(ret, data);
+        ret += implode(compiled[1][random(sizeof(compiled[1]))], adjective);
     }
+    if (sizeof(compiled[2]))
+    {
+        ret += implode(compiled[2][random(sizeof(compiled[2]))], adjective);
+    }
+
     if (displayEntryMessage())
     {
-        ret = parseEntryAction(ret, data);
+        ret = suppressEntryMessage() ? "" : 
+            environmentDictionary()->getEntryMessage() + " " + ret + ".";
     }
-    ret = parseAdjectives(ret, data);
     return ret;
 }
 
@@ -187,13 +202,12 @@ public nomask varargs string description(string state)
     if (member(descriptionData, state) && member(descriptionData[state],
         "template"))
     {
-        ret = parseTemplate(descriptionData[state]["template"], descriptionData[state]);
+        ret = renderTemplate(state, "template");
     }
     else if (member(descriptionData, "default") && 
         member(descriptionData["default"], "template"))
     {
-        ret = parseTemplate(descriptionData["default"]["template"],
-            descriptionData["default"]);
+        ret = renderTemplate("default", "template");
     }
 
     if (!ret)
@@ -214,16 +228,12 @@ public nomask string long(int brief)
     if (member(descriptionData, state) && member(descriptionData[state],
         "item template"))
     {
-        ret = introText +
-            parseTemplate(descriptionData[state]["item template"],
-                descriptionData[state]) + ".\n";
+        ret = introText + renderTemplate(state, "item template") + ".\n";
     }
     else if (member(descriptionData, "default") && 
         member(descriptionData["default"], "item template"))
     {
-        ret = introText +
-            parseTemplate(descriptionData["default"]["item template"],
-                descriptionData["default"]) + ".\n";
+        ret = introText + renderTemplate("default", "item template") + ".\n";
     }
 
     if (!ret)
@@ -247,6 +257,7 @@ protected nomask varargs void addAdjectives(string *list, string state)
         descriptionData[state] = ([]);
     }
     descriptionData[state]["adjectives"] = list;
+    invalidateCompiledTemplates(state);
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -262,6 +273,7 @@ protected nomask varargs void addDescriptionTemplate(string template, string sta
         descriptionData[state] = ([]);
     }
     descriptionData[state]["template"] = template;
+    invalidateCompiledTemplates(state);
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -277,6 +289,7 @@ protected nomask varargs void addItemTemplate(string template, string state)
         descriptionData[state] = ([]);
     }
     descriptionData[state]["item template"] = template;
+    invalidateCompiledTemplates(state);
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -314,6 +327,7 @@ protected nomask varargs void addSeasonDescription(string season, string *list,
             descriptionData[state] = ([]);
         }
         descriptionData[state][season] = list;
+        invalidateCompiledTemplates(state);
     }
 }
 
@@ -346,6 +360,7 @@ protected nomask varargs void addTimeOfDayDescription(string period, string *lis
                 descriptionData[state][period][item] = list;
             }
         }
+        invalidateCompiledTemplates(state);
     }
 }
 
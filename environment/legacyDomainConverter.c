@@ -0,0 +1,292 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+
+// Converting a domain is done a slice at a time: each call_out converts
+// rooms until it has used EvalBudget, then schedules the next slice. This
+// keeps a domain of thousands of rooms from running out of eval cost.
+private nosave int EvalBudget = 250000;
+private nosave string ReportFile = "conversionReport.txt";
+
+// source directory -> ([ "destination", "requester", "pending", "converted",
+//                        "skipped", "failed", "scheduled" ])
+private nosave mapping batches = ([]);
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask string normalizeDirectory(string directory)
+{
+    string ret = 0;
+    if (directory && stringp(directory) && sizeof(directory))
+    {
+        ret = (directory[0] == '/') ? directory : "/" + directory;
+        while ((sizeof(ret) > 1) && (ret[<1] == '/'))
+        {
+            ret = ret[0..<2];
+        }
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int isAuthorized(object requester, string source,
+    string destination)
+{
+    // Converting reads the whole source domain and overwrites files in the
+    // destination, so only trusted callers or a wizard acting for themself
+    // with access to both can do it.
+    object caller = previous_object();
+
+    return canAccessDatabase(caller) || (objectp(requester) &&
+        ((requester == caller) || (requester == this_player())) &&
+        (member(inherit_list(requester), "lib/realizations/wizard.c") > -1) &&
+        requester->hasReadAccess(source) &&
+        requester->hasWriteAccess(destination));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask varargs int convertDomain(string source, string destination,
+    object requester)
+{
+    int ret = 0;
+    source = normalizeDirectory(source);
+    destination = normalizeDirectory(destination);
+
+    if (!isAuthorized(requester, source, destination))
+    {
+        raise_error(sprintf("ERROR in legacyDomainConverter.c: %O is not "
+            "allowed to convert '%s' to '%s'.\n", previous_object(),
+            to_string(source), to_string(destination)));
+    }
+
+    if (!source || (file_size(source) != -2) || !destination ||
+        (source == destination))
+    {
+        raise_error(sprintf("ERROR in legacyDomainConverter.c: '%s' is not "
+            "a valid legacy domain or '%s' is not a valid destination.\n",
+            to_string(source), to_string(destination)));
+    }
+
+    if (!member(batches, source) || !sizeof(batches[source]["pending"]))
+    {
+        batches[source] = ([
+            "destination": destination,
+            "requester": requester,
+            "pending": ({ source }),
+            "converted": ({}),
+            "skipped": ({}),
+            "failed": ([]),
+            "scheduled": 1
+        ]);
+        call_out("continueBatch", 0, source);
+        ret = 1;
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void createDirectories(string file)
+{
+    string path = "";
+    string *directories = explode(file, "/") - ({ "" });
+
+    foreach(string directory in directories[0..<2])
+    {
+        path += "/" + directory;
+        if (file_size(path) != -2)
+        {
+            mkdir(path);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void expandDirectory(string directory, mapping batch)
+{
+    string *files = sort_array(get_dir(directory + "/*", 0x01) || ({}),
+        (: $1 > $2 :));
+
+    foreach(string file in files)
+    {
+        string path = directory + "/" + file;
+        if ((file != ".") && (file != "..") &&
+            ((file_size(path) == -2) || ((sizeof(file) > 2) &&
+            (file[<2..] == ".c"))))
+        {
+            batch["pending"] += ({ path });
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void convertRoom(string source, string file, mapping batch)
+{
+    object room = 0;
+    int wasLoaded = objectp(find_object(file));
+
+    string err = catch (room = load_object(file); nolog);
+    if (err)
+    {
+        batch["failed"][file] = err;
+    }
+    else if (!function_exists("generateNewRoom", room))
+    {
+        batch["skipped"] += ({ file });
+    }
+    else
+    {
+        string newRoom = 0;
+        err = catch (newRoom = room->generateNewRoom(); nolog);
+
+        if (err || !stringp(newRoom))
+        {
+            batch["failed"][file] = err || "No room was generated.\n";
+        }
+        else
+        {
+            string target = batch["destination"] + file[sizeof(source)..];
+            createDirectories(target);
+            if (file_size(target) > -1)
+            {
+                rm(target);
+            }
+            write_file(target, newRoom);
+            batch["converted"] += ({ file });
+        }
+    }
+
+    // Legacy rooms are only loaded to be converted - there is no sense
+    // in keeping thousands of them around once that's done.
+    if (room && !wasLoaded)
+    {
+        destruct(room);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask string generateReport(string source, mapping batch)
+{
+    string ret = sprintf("Legacy room conversion: %s -> %s\n"
+        "Converted: %d\nSkipped: %d\nFailed: %d\n", source,
+        batch["destination"], sizeof(batch["converted"]),
+        sizeof(batch["skipped"]), sizeof(batch["failed"]));
+
+    foreach(string file in sort_array(m_indices(batch["failed"]),
+        (: $1 > $2 :)))
+    {
+        ret += sprintf("    %s: %s", file, batch["failed"][file]);
+        if (ret[<1] != '\n')
+        {
+            ret += "\n";
+        }
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void completeBatch(string source, mapping batch)
+{
+    string report = generateReport(source, batch);
+    string reportFile = batch["destination"] + "/" + ReportFile;
+
+    createDirectories(reportFile);
+    if (file_size(reportFile) > -1)
+    {
+        rm(reportFile);
+    }
+    write_file(reportFile, report);
+
+    if (objectp(batch["requester"]))
+    {
+        tell_object(batch["requester"], report);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int convertSlice(string source)
+{
+    int ret = 0;
+
+    if (member(batches, source) &&
+        sizeof(batches[source]["pending"]))
+    {
+        mapping batch = batches[source];
+        int startingCost = get_eval_cost();
+
+        while (sizeof(batch["pending"]) &&
+            ((startingCost - get_eval_cost()) < EvalBudget))
+        {
+            string file = batch["pending"][0];
+            batch["pending"] = batch["pending"][1..];
+
+            if (file_size(file) == -2)
+            {
+                expandDirectory(file, batch);
+            }
+            else
+            {
+                convertRoom(source, file, batch);
+            }
+        }
+
+        ret = sizeof(batch["pending"]);
+        if (ret && !batch["scheduled"])
+        {
+            batch["scheduled"] = 1;
+            call_out("continueBatch", 1, source);
+        }
+        else if (!ret)
+        {
+            completeBatch(source, batch);
+        }
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask int processBatch(string source)
+{
+    int ret = 0;
+    source = normalizeDirectory(source);
+
+    if (source && member(batches, source))
+    {
+        if (!isAuthorized(batches[source]["requester"], source,
+            batches[source]["destination"]))
+        {
+            raise_error(sprintf("ERROR in legacyDomainConverter.c: %O is not "
+                "allowed to convert '%s'.\n", previous_object(), source));
+        }
+        ret = convertSlice(source);
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+static nomask void continueBatch(string source)
+{
+    if (member(batches, source))
+    {
+        batches[source]["scheduled"] = 0;
+        convertSlice(source);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask mapping conversionReport(string source)
+{
+    mapping ret = 0;
+    source = normalizeDirectory(source);
+
+    if (source && member(batches, source))
+    {
+        ret = ([
+            "destination": batches[source]["destination"],
+            "pending": sizeof(batches[source]["pending"]),
+            "converted": batches[source]["converted"] + ({}),
+            "skipped": batches[source]["skipped"] + ({}),
+            "failed": batches[source]["failed"] + ([])
+        ]);
+    }
+    return ret;
+}
@@ -3,8 +3,274 @@
 //                      the accompanying LICENSE file for details.
 //*****************************************************************************
 
+// Regions index their rooms by coordinate so that maps and routes can be
+// built without loading the rooms themselves. The grid is broken into
+// TileSize x TileSize tiles. A tile's overhead map is only rendered the
+// first time a map that overlaps it is requested and is thrown away when
+// one of its cells changes.
+private nosave int TileSize = 16;
+private nosave string EmptySymbol = " ";
+private nosave string DefaultSymbol = ".";
+private nosave string CurrentLocationSymbol = "@";
+private nosave int DefaultViewportRadius = 5;
+
+private string regionName = 0;
+private int width = 0;
+private int height = 0;
+
+// "x,y" -> ([ "room": path, "symbol": string ])
+private mapping cells = ([]);
+
+// room path -> ({ x, y })
+private mapping roomIndex = ([]);
+
+// "tileX,tileY" -> ({ row, row, ... }) of rendered map
+private nosave mapping tiles = ([]);
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask varargs string Name(string newName)
+{
+    if (newName && stringp(newName))
+    {
+        regionName = newName;
+    }
+    return regionName;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public void Setup()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void reset(int arg)
+{
+    if (!arg && !regionName)
+    {
+        Setup();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask string coordinateKey(int x, int y)
+{
+    return sprintf("%d,%d", x, y);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask string tileKey(int x, int y)
+{
+    return sprintf("%d,%d", x / TileSize, y / TileSize);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask string normalizePath(string path)
+{
+    if (path && sizeof(path) && (path[0] != '/'))
+    {
+        path = "/" + path;
+    }
+    return path;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask int isValidCoordinate(int x, int y)
+{
+    return (x >= 0) && (y >= 0) && (x < width) && (y < height);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+protected nomask void setDimensions(int newWidth, int newHeight)
+{
+    if ((newWidth > 0) && (newHeight > 0))
+    {
+        width = newWidth;
+        height = newHeight;
+        tiles = ([]);
+    }
+    else
+    {
+        raise_error(sprintf("ERROR in region.c: %dx%d are not valid "
+            "dimensions for a region.\n", newWidth, newHeight));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask int *dimensions()
+{
+    return ({ width, height });
+}
+
 /////////////////////////////////////////////////////////////////////////////
-public nomask string getRelativeOverheadMap(int x, int y)
+private nomask void setCell(int x, int y, string path, string symbol)
 {
-    return 0;
+    if (!isValidCoordinate(x, y))
+    {
+        raise_error(sprintf("ERROR in region.c: coordinates(%d,%d) are "
+            "not valid for this region.\n", x, y));
+    }
+
+    string key = coordinateKey(x, y);
+    if (member(cells, key) && cells[key]["room"])
+    {
+        m_delete(roomIndex, cells[key]["room"]);
+    }
+
+    cells[key] = ([ "room": path, "symbol": symbol ]);
+    if (path)
+    {
+        roomIndex[path] = ({ x, y });
+    }
+    m_delete(tiles, tileKey(x, y));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+protected nomask varargs void addRoom(int x, int y, string path,
+    string symbol)
+{
+    if (!stringp(path) || (file_size(normalizePath(path)) <= 0))
+    {
+        raise_error(sprintf("ERROR in region.c: '%s' is not a valid "
+            "room.\n", to_string(path)));
+    }
+
+    if (!stringp(symbol) || (sizeof(symbol) != 1))
+    {
+        symbol = DefaultSymbol;
+    }
+    setCell(x, y, normalizePath(path), symbol);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void registerRoom(int x, int y, string path)
+{
+    // Rooms that set their own coordinates are added to the index as they
+    // load. Rooms that were already declared by the region keep the symbol
+    // they were declared with.
+    path = normalizePath(path);
+    string key = coordinateKey(x, y);
+
+    if (!member(cells, key) || (cells[key]["room"] != path))
+    {
+        setCell(x, y, path, (member(cells, key) && cells[key]["symbol"]) ?
+            cells[key]["symbol"] : DefaultSymbol);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask string roomAt(int x, int y)
+{
+    string key = coordinateKey(x, y);
+    return member(cells, key) ? cells[key]["room"] : 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask int *coordinatesOf(string path)
+{
+    path = normalizePath(path);
+    return member(roomIndex, path) ? roomIndex[path] + ({}) : 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask string *rooms()
+{
+    return m_indices(roomIndex);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask string *renderTile(int tileX, int tileY)
+{
+    string *ret = ({});
+    string key = sprintf("%d,%d", tileX, tileY);
+
+    if (member(tiles, key))
+    {
+        ret = tiles[key];
+    }
+    else
+    {
+        for (int y = tileY * TileSize; y < (tileY + 1) * TileSize; y++)
+        {
+            string row = "";
+            for (int x = tileX * TileSize; x < (tileX + 1) * TileSize; x++)
+            {
+                string cell = coordinateKey(x, y);
+                row += member(cells, cell) ? cells[cell]["symbol"] :
+                    EmptySymbol;
+            }
+            ret += ({ row });
+        }
+        tiles[key] = ret;
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask string mapRow(int y, int startX, int endX)
+{
+    string ret = "";
+
+    if ((y < 0) || (y >= height))
+    {
+        ret = sprintf("%*s", endX - startX + 1, "");
+    }
+    else
+    {
+        int x = startX;
+        while (x <= endX)
+        {
+            if ((x < 0) || (x >= width))
+            {
+                ret += EmptySymbol;
+                x++;
+            }
+            else
+            {
+                // Take as much of this row as the tile holds in one slice.
+                int tileX = x / TileSize;
+                int lastX = (tileX + 1) * TileSize - 1;
+                if (lastX > endX)
+                {
+                    lastX = endX;
+                }
+                if (lastX >= width)
+                {
+                    lastX = width - 1;
+                }
+
+                string *tile = renderTile(tileX, y / TileSize);
+                ret += tile[y % TileSize][(x % TileSize)..(lastX % TileSize)];
+                x = lastX + 1;
+            }
+        }
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask varargs string getRelativeOverheadMap(int x, int y,
+    int radius)
+{
+    string ret = 0;
+
+    if (isValidCoordinate(x, y))
+    {
+        if (radius <= 0)
+        {
+            radius = DefaultViewportRadius;
+        }
+
+        string *rows = ({});
+        for (int row = y - radius; row <= y + radius; row++)
+        {
+            string line = mapRow(row, x - radius, x + radius);
+            if (row == y)
+            {
+                line[radius] = CurrentLocationSymbol[0];
+            }
+            rows += ({ line });
+        }
+        ret = implode(rows, "\n") + "\n";
+    }
+    return ret;
 }
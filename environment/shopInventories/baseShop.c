@@ -132,6 +132,15 @@ public nomask void resetInventory()
     list = ([]);
 }
 
+/////////////////////////////////////////////////////////////////////////////
+public nomask void restoreInventory(mapping inventory)
+{
+    if (mappingp(inventory))
+    {
+        list += deep_copy(inventory);
+    }
+}
+
 /////////////////////////////////////////////////////////////////////////////
 public nomask void initiateShopInteraction(object user)
 {
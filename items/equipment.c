@@ -643,7 +643,7 @@ public varargs int drop(int silently)
         }
         if(!ret)
         {
-            move_object(this_object(), environment(env));
+            moveObject(this_object(), environment(env));
         }
     }
     return ret;
@@ -16,6 +16,8 @@ protected nosave string MaterialsBlueprint = "/lib/dictionaries/materialsDiction
 private nosave string CraftingDictionary = "/lib/dictionaries/craftingDictionary.c";
 private nosave string MessageParser = "/lib/core/messageParser.c";
 private nosave string BonusesBlueprint = "/lib/dictionaries/bonusesDictionary.c";
+private nosave int SerializationVersion = 1;
+private nosave mapping blueprintDefaults = 0;
 
 protected mapping itemData = ([ 
 //  "aliases": ({ }),  // string array of alternate names for item
@@ -100,6 +102,150 @@ protected nomask int isValidBonus(string bonus, int amount)
     return ret;
 }
     
+/////////////////////////////////////////////////////////////////////////////
+private nomask int itemDataMatches(mixed first, mixed second)
+{
+    int ret = 0;
+    if (mappingp(first) && mappingp(second))
+    {
+        ret = sizeof(first) == sizeof(second);
+        foreach(mixed key in m_indices(first))
+        {
+            if (ret && (!member(second, key) ||
+                !itemDataMatches(first[key], second[key])))
+            {
+                ret = 0;
+            }
+        }
+    }
+    else if (pointerp(first) && pointerp(second))
+    {
+        ret = sizeof(first) == sizeof(second);
+        for (int i = 0; ret && (i < sizeof(first)); i++)
+        {
+            ret = itemDataMatches(first[i], second[i]);
+        }
+    }
+    else
+    {
+        ret = first == second;
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask mapping blueprintItemData()
+{
+    return deep_copy(itemData);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask mapping getBlueprintDefaults()
+{
+    if (!blueprintDefaults)
+    {
+        blueprintDefaults = ([]);
+
+        if (clonep(this_object()))
+        {
+            object blueprint = load_object(program_name(this_object()));
+            if (blueprint)
+            {
+                blueprintDefaults = blueprint->blueprintItemData();
+            }
+        }
+    }
+    return blueprintDefaults;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int isMaterialsDefault(string element)
+{
+    int ret = 0;
+    switch (element)
+    {
+        case "value":
+        {
+            ret = itemData["value"] == 
+                materialsObject()->getDefaultValue(this_object());
+            break;
+        }
+        case "long":
+        {
+            ret = itemData["long"] == materialsObject()->getBlueprintModifier(
+                this_object(), "default description");
+            break;
+        }
+        case "primary component":
+        {
+            ret = itemData["primary component"] == 
+                materialsObject()->getBlueprintModifier(this_object(), 
+                    "primary component");
+            break;
+        }
+        case "crafting type":
+        {
+            ret = itemData["crafting type"] == 
+                materialsObject()->getBlueprintModifier(this_object(), 
+                    "subtype");
+            break;
+        }
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask string serializeItemData()
+{
+    mapping defaults = getBlueprintDefaults();
+    mapping delta = ([]);
+
+    foreach(string element in m_indices(itemData))
+    {
+        if (member(defaults, element) ? 
+            !itemDataMatches(itemData[element], defaults[element]) :
+            !isMaterialsDefault(element))
+        {
+            delta[element] = itemData[element];
+        }
+    }
+
+    return save_value(([
+        "serialization version": SerializationVersion,
+        "set": delta,
+        "unset": m_indices(defaults) - m_indices(itemData)
+    ]));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void deserializeItemData(string data)
+{
+    mixed serializedData = restore_value(data);
+
+    if (mappingp(serializedData) && 
+        member(serializedData, "serialization version"))
+    {
+        if (serializedData["serialization version"] != SerializationVersion)
+        {
+            raise_error(sprintf("Item: Unsupported serialization version "
+                "%O.\n", serializedData["serialization version"]));
+        }
+
+        itemData = deep_copy(getBlueprintDefaults()) + 
+            serializedData["set"];
+
+        foreach(string element in serializedData["unset"])
+        {
+            m_delete(itemData, element);
+        }
+    }
+    else if (mappingp(serializedData))
+    {
+        // Rows written before delta serialization hold the full item data.
+        itemData = serializedData;
+    }
+}
+
 /////////////////////////////////////////////////////////////////////////////
 public mixed query(string element)
 {
@@ -171,6 +317,11 @@ public mixed query(string element)
                 ret = save_value(itemData);
                 break;
             }
+            case "delta":
+            {
+                ret = serializeItemData();
+                break;
+            }
             case "type":
             {
                 ret = "item";
@@ -327,6 +478,7 @@ public varargs int set(string element, mixed data)
                 case "read message identified":            
                 case "short":
                 case "all":
+                case "delta":
                 {
                     if(!data || !stringp(data))
                     {
@@ -413,6 +565,10 @@ public varargs int set(string element, mixed data)
         {
             itemData = restore_value(data);
         }
+        else if (element == "delta")
+        {
+            deserializeItemData(data);
+        }
         else if(mappingp(data))
         {
             itemData[element] = data + ([ ]);
@@ -425,6 +581,11 @@ public varargs int set(string element, mixed data)
         {
             itemData[element] = data;
         }
+
+        if (member(({ "name", "short", "aliases", "all", "delta" }), element) > -1)
+        {
+            aliasesChanged();
+        }
     }
     return ret;
 }
@@ -437,6 +598,11 @@ public int unset(string element)
     {
         ret = 1;
         m_delete(itemData, element);
+
+        if (member(({ "name", "short", "aliases" }), element) > -1)
+        {
+            aliasesChanged();
+        }
     }
     return ret;
 }
@@ -597,7 +763,7 @@ public varargs string long(int doNotApplyUserStatistics)
 }
 
 /////////////////////////////////////////////////////////////////////////////
-public int id(string item)
+public string *targetAliases()
 {
     string *aliases = ({ query("name"), lower_case(query("name")), query("short"),
         lower_case(query("short")) });
@@ -605,6 +771,13 @@ public int id(string item)
     {
         aliases += query("aliases");
     }
+    return aliases;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public int id(string item)
+{
+    string *aliases = targetAliases();
     return (item && stringp(item) && aliases && (member(aliases, item) > -1));
 }
 
@@ -652,7 +825,7 @@ public varargs int drop(int silently)
         if (env && environment(env))
         {
             ret = 0;
-            move_object(this_object(), environment(env));
+            moveObject(this_object(), environment(env));
         }
     }
     return ret;
@@ -8,6 +8,9 @@
 virtual inherit "/lib/core/thing.c";
 #include "/lib/modules/secure/combat.h"
 
+private nosave string *BonusServices = ({ "races", "guilds", "research",
+    "traits", "biological", "background" });
+
 //-----------------------------------------------------------------------------
 // Method: combatDelay
 // Description: This property is used to determine if an interactive object can
@@ -135,10 +138,7 @@ private nomask int calculateServiceBonuses(string methodToCheck)
 {
     int ret = 0;
     
-    string *servicesToCheck = ({ "races", "guilds", "research", "traits",
-                                 "biological", "background" });
-    
-    foreach(string serviceToCheck in servicesToCheck)
+    foreach(string serviceToCheck in BonusServices)
     {
         object service = getService(serviceToCheck);
         if(service)
@@ -160,6 +160,42 @@ private nomask int calculateServiceBonuses(string methodToCheck)
     return ret;
 }   
 
+//-----------------------------------------------------------------------------
+// Method: serviceBonusSources
+// Description: This method returns where the service bonuses that are
+//              applied for methodToCheck come from. Services that track the
+//              individual sources of their bonuses (for example, each trait
+//              or guild) report them, the others report their total.
+//
+// Parameters: methodToCheck - the type of bonus for which to check
+//
+// Returns: a mapping of service to its sources and their bonuses
+//-----------------------------------------------------------------------------
+public nomask mapping serviceBonusSources(string methodToCheck)
+{
+    mapping ret = ([]);
+
+    foreach(string serviceToCheck in BonusServices)
+    {
+        object service = getService(serviceToCheck);
+        if(service)
+        {
+            string sourcesMethod = sprintf("%sBonusSources", serviceToCheck);
+            mapping sources = function_exists(sourcesMethod, service) ?
+                call_other(service, sourcesMethod, methodToCheck) :
+                ([ serviceToCheck: call_other(service, 
+                    sprintf("%sBonusTo", serviceToCheck), methodToCheck) ]);
+
+            sources = filter(sources, (: $2 != 0 :));
+            if (sizeof(sources))
+            {
+                ret[serviceToCheck] = sources;
+            }
+        }
+    }
+    return ret;
+}
+
 //-----------------------------------------------------------------------------
 // Method: maxHitPoints
 // Description: This method returns the effective total maximum hit points that
@@ -1165,7 +1201,7 @@ private nomask void generateCorpse(object murderer)
                 corpse->set("killed by player", murderer->RealName());
             }
 
-            move_object(corpse, environment(this_object()));
+            moveObject(corpse, environment(this_object()));
         }
     }
 }
@@ -244,6 +244,7 @@ public nomask int advanceLevel(string guild)
         // granted research, traits, skills, etc.
         guilds[guild]["level"] = guildsDictionary()->advanceLevel(
             this_object(), guild);
+        guildBonusTable = ([]);
 
         // canAdvanceLevel will ensure that experience >= experienceToNextLevel
         guilds[guild]["experience"] = guilds[guild]["experience"] -
@@ -305,6 +306,7 @@ public nomask int advanceRank(string guild)
     {
         guilds[guild]["rank"] = guildsDictionary()->advanceRank(this_object(),
             guild, guilds[guild]["rank"]);
+        guildBonusTable = ([]);
         guilds[guild]["title"] = guildsDictionary()->title(guild, 
             guilds[guild]["level"], guilds[guild]["rank"]);
         guilds[guild]["pretitle"] = guildsDictionary()->pretitle(guild, 
@@ -340,6 +342,7 @@ public nomask int demoteRank(string guild)
     {
         guilds[guild]["rank"] = guildsDictionary()->demoteRank(
             this_object(), guild, guilds[guild]["rank"]);
+        guildBonusTable = ([]);
 
         guilds[guild]["title"] = guildsDictionary()->title(guild, 
             guilds[guild]["level"], guilds[guild]["rank"]);
@@ -426,6 +429,8 @@ public nomask int joinGuild(string guild)
     }
     if(ret)
     {
+        guildBonusTable = ([]);
+
         // Trigger distribution of unassigned experience points
         addExperience(0);
 
@@ -462,6 +467,8 @@ public nomask int leaveGuild(string guild)
 
     if(ret)
     {
+        guildBonusTable = ([]);
+
         object events = getService("events");
         if(events && objectp(events))
         {
@@ -494,34 +501,55 @@ public nomask mapping *guildsExtraAttacks()
 }
 
 /////////////////////////////////////////////////////////////////////////////
-public nomask int guildsBonusTo(string bonus)
+public nomask mapping guildsBonusSources(string bonus)
 {
-    int ret = 0;
-    
-    if(function_exists(bonus, guildsDictionary()))
+    if (!member(guildBonusTable, bonus))
     {
-        foreach(string guild in m_indices(guilds))
+        mapping sources = ([]);
+
+        string method = function_exists(bonus, guildsDictionary()) ? bonus :
+            (function_exists("BonusSkillModifier", guildsDictionary()) ?
+            "BonusSkillModifier" : 0);
+
+        if (method)
         {
-            if(memberOfGuild(guild) || (member(guilds, guild) &&
-                member(guilds[guild], "left guild")))
+            foreach(string guild in m_indices(guilds))
             {
-                ret += call_other(guildsDictionary(), bonus, guild,
-                    guilds[guild]["level"], guilds[guild]["rank"]);
+                if(memberOfGuild(guild) || (member(guilds, guild) &&
+                    member(guilds[guild], "left guild")))
+                {
+                    int amount = (method == bonus) ?
+                        call_other(guildsDictionary(), bonus, guild,
+                            guilds[guild]["level"], guilds[guild]["rank"]) :
+                        call_other(guildsDictionary(), "BonusSkillModifier", 
+                            guild, bonus, guilds[guild]["level"], 
+                            guilds[guild]["rank"]);
+
+                    if (amount)
+                    {
+                        sources[guild] = amount;
+                    }
+                }
             }
         }
+        guildBonusTable[bonus] = sources;
     }
-    else if(function_exists("BonusSkillModifier", guildsDictionary()))
+    return guildBonusTable[bonus] + ([]);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask int guildsBonusTo(string bonus)
+{
+    int ret = 0;
+    
+    if (!member(guildBonusTable, bonus))
     {
-        foreach(string guild in m_indices(guilds))
-        {
-            if (memberOfGuild(guild) || (member(guilds, guild) &&
-                member(guilds[guild], "left guild")))
-            {
-                ret += call_other(guildsDictionary(), "BonusSkillModifier", 
-                    guild, bonus, guilds[guild]["level"], 
-                    guilds[guild]["rank"]);
-            }
-        }
+        guildsBonusSources(bonus);
+    }
+
+    foreach(string guild, int amount in guildBonusTable[bonus])
+    {
+        ret += amount;
     }
     return ret;
 } 
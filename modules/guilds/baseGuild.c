@@ -6,6 +6,7 @@
 //                      the accompanying LICENSE file for details.
 //*****************************************************************************
 virtual inherit "/lib/core/prerequisites.c";
+virtual inherit "/lib/core/dictionaryAccess.c";
 
 private int MaxLevel = 1000;
 private float ExperienceMultiplier = 1.0;
@@ -126,23 +127,180 @@ private mapping criteriaMap = ([
 //  ])
 ]);
 
+// Tables compiled from bonusGrid, advancementGrid and criteriaMap. Bonus and
+// attack tables hold running totals indexed by level for each rank so that a
+// query is a single lookup. They are rebuilt whenever criteria are added.
+private nosave mapping compiledBonuses = 0;
+private nosave mapping compiledAttacks = 0;
+private nosave mapping compiledAdvancement = 0;
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int isBonusAttack(string bonusItem)
+{
+    int ret = 0;
+    string attackType = 0;
+    if(bonusItem && stringp(bonusItem) && member(bonusGrid, bonusItem) &&
+       sscanf(bonusItem, "%s attack", attackType) && 
+       getDictionary("attacks"))
+    {
+        ret = (getDictionary("attacks")->getAttack(attackType) != 0) || 
+              (attackType == "weapon");
+    }
+    return ret;
+}
+
 /////////////////////////////////////////////////////////////////////////////
-protected nomask object getDictionary(string service)
+private nomask int *cumulativeLevels(mapping levels, int maxLevel)
 {
-    object ret = 0;
-    
-    if(service && stringp(service))
+    int *ret = allocate(maxLevel + 1);
+
+    int total = 0;
+    for (int level = 1; level <= maxLevel; level++)
     {
-        string dictionary = sprintf("/lib/dictionaries/%sDictionary.c",
-            service);
-        if(file_size(dictionary) > -1)
+        if (levels && member(levels, level))
         {
-            ret = load_object(dictionary);
+            total += levels[level];
         }
+        ret[level] = total;
     }
     return ret;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+private nomask int *addLevelTotals(int *first, int *second, int offset)
+{
+    int *ret = allocate(sizeof(first));
+    for (int level = 0; level < sizeof(first); level++)
+    {
+        ret[level] = first[level] + (second ? second[level] : 0) + offset;
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int highestGridLevel(mapping grid)
+{
+    int ret = 1;
+    foreach(string rank, mapping levels in grid)
+    {
+        foreach(int level in m_indices(levels))
+        {
+            ret = (level > ret) ? level : ret;
+        }
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int appliesAtRankOnly(string key)
+{
+    return member(criteriaMap, key) &&
+        !member(criteriaMap[key], "begin at level") &&
+        member(criteriaMap[key], "begin at rank");
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask mapping compileBonusTable(string key)
+{
+    mapping grid = bonusGrid[key];
+    int maxLevel = highestGridLevel(grid);
+    int rankOnly = appliesAtRankOnly(key);
+
+    // Items that begin at a rank rather than a level also grant their level
+    // one amount once the rank is held. Members of ranks that do not have
+    // their own entry get the default totals.
+    int *defaultLevels = cumulativeLevels(
+        member(grid, "default") ? grid["default"] : 0, maxLevel);
+    int defaultOffset = (rankOnly && member(grid, "default")) ?
+        grid["default"][1] : 0;
+
+    mapping ret = ([ "default":
+        addLevelTotals(defaultLevels, 0, defaultOffset) ]);
+
+    foreach(string rank, mapping levels in grid)
+    {
+        if (rank != "default")
+        {
+            ret[rank] = addLevelTotals(defaultLevels,
+                cumulativeLevels(levels, maxLevel),
+                (rankOnly ? levels[1] : 0) + defaultOffset);
+        }
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask mapping compileAttackTable(string key)
+{
+    mapping grid = bonusGrid[key];
+    int maxLevel = highestGridLevel(grid);
+    int rankOnly = appliesAtRankOnly(key);
+
+    string attack = 0;
+    sscanf(key, "%s attack", attack);
+
+    // Unlike bonuses, ranks without their own entry only get the default
+    // attacks gained by level.
+    int *defaultLevels = cumulativeLevels(
+        member(grid, "default") ? grid["default"] : 0, maxLevel);
+
+    mapping ret = ([
+        "attack": getDictionary("attacks")->getAttackMapping(attack,
+            (member(criteriaMap[key], "base damage") ?
+            criteriaMap[key]["base damage"] : 1), 35),
+        "unranked": defaultLevels,
+        "ranks": ([ ])
+    ]);
+
+    foreach(string rank, mapping levels in grid)
+    {
+        ret["ranks"][rank] = (rank == "default") ?
+            addLevelTotals(defaultLevels, 0, rankOnly ? levels[1] : 0) :
+            addLevelTotals(defaultLevels, cumulativeLevels(levels, maxLevel),
+                rankOnly ? levels[1] : 0);
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void compileGuildTables()
+{
+    compiledBonuses = ([ ]);
+    compiledAttacks = ([ ]);
+    compiledAdvancement = ([ ]);
+
+    object bonuses = getDictionary("bonuses");
+    foreach(string key in m_indices(bonusGrid))
+    {
+        if (isBonusAttack(key))
+        {
+            compiledAttacks[key] = compileAttackTable(key);
+        }
+        if (bonuses && bonuses->isValidBonus(key))
+        {
+            compiledBonuses[key] = compileBonusTable(key);
+        }
+    }
+
+    // The criteria granted at each level or rank are applied in a fixed
+    // order rather than whatever order the mapping happens to yield.
+    foreach(mixed level, mapping criteria in advancementGrid)
+    {
+        if (criteria && mappingp(criteria))
+        {
+            compiledAdvancement[level] = map(sort_array(m_indices(criteria),
+                (: $1 > $2 :)), (: $2[$1] :), criteria);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int levelTotal(int *totals, int level)
+{
+    return totals[(level < 0) ? 0 :
+        ((level >= sizeof(totals)) ? (sizeof(totals) - 1) : level)];
+}
+
 /////////////////////////////////////////////////////////////////////////////
 public void SetupGuild()
 {   
@@ -156,6 +314,7 @@ public nomask void reset(int arg)
         if (guildName == "BaseGuild")
         {
             SetupGuild();
+            compileGuildTables();
         }
 
         object guildDictionary = getDictionary("guilds");
@@ -456,6 +615,7 @@ protected nomask int addCriteria(string key, mapping criteria)
        isValidCriteria(criteria))
     {
         criteriaMap[key] = criteria + ([ ]);
+        compiledBonuses = 0;
         
         string rank = (member(criteria, "begin at rank") &&
             stringp(criteria["begin at rank"])) ?
@@ -576,37 +736,16 @@ public nomask int queryBonus(string bonus, int level, string rank)
             rank = "default";
         }
 
-        if(getDictionary("bonuses") && objectp(getDictionary("bonuses")) &&
-           getDictionary("bonuses")->isValidBonus(bonusToCheck) &&
-           member(bonusGrid, bonusToCheck))
+        if (!compiledBonuses)
         {
-            for(int levelToApply = 1; levelToApply <= level; levelToApply++)
-            {
-                if (rank != "default" &&
-                    member(bonusGrid[bonusToCheck], "default") &&
-                    member(bonusGrid[bonusToCheck]["default"], levelToApply))
-                {
-                    ret += bonusGrid[bonusToCheck]["default"][levelToApply];
-                }
-                if(member(bonusGrid[bonusToCheck], rank) &&
-                    member(bonusGrid[bonusToCheck][rank], levelToApply))
-                {
-                    ret += bonusGrid[bonusToCheck][rank][levelToApply];
-                }
-            }
-            if(!member(criteriaMap[bonusToCheck], "begin at level") &&
-                member(criteriaMap[bonusToCheck], "begin at rank") && 
-                member(bonusGrid[bonusToCheck], rank))
-            {
-                ret += bonusGrid[bonusToCheck][rank][1];
-            }
-            if (rank != "default" && 
-                !member(criteriaMap[bonusToCheck], "begin at level") &&
-                member(criteriaMap[bonusToCheck], "begin at rank") &&
-                member(bonusGrid[bonusToCheck], "default"))
-            {
-                ret += bonusGrid[bonusToCheck]["default"][1];
-            }
+            compileGuildTables();
+        }
+
+        if(member(compiledBonuses, bonusToCheck))
+        {
+            ret = levelTotal(member(compiledBonuses[bonusToCheck], rank) ?
+                compiledBonuses[bonusToCheck][rank] :
+                compiledBonuses[bonusToCheck]["default"], level);
         }
     }
     return ret;
@@ -807,15 +946,16 @@ private nomask int applyAdvancementCriteria(int newLevel, object guildMember)
 {
     int ret = 1;
 
-    string *criteriaToApply = ({ });
-    if(member(advancementGrid, newLevel) && advancementGrid[newLevel] && 
-       mappingp(advancementGrid[newLevel]))
+    if (!compiledBonuses)
     {
-        criteriaToApply = m_indices(advancementGrid[newLevel]);
-        foreach(string criterion in criteriaToApply)
+        compileGuildTables();
+    }
+
+    if(member(compiledAdvancement, newLevel))
+    {
+        foreach(mapping criterion in compiledAdvancement[newLevel])
         {
-            ret &&= applyAdvancementCriterion(
-                advancementGrid[newLevel][criterion], guildMember);
+            ret &&= applyAdvancementCriterion(criterion, guildMember);
         }
     }
     return ret;
@@ -843,15 +983,18 @@ public nomask string advanceRank(object guildMember, string currentRank)
     {
         string nextRank = getNextRank(currentRank);
 
-        if(member(advancementGrid, nextRank) && advancementGrid[nextRank] &&
-           mappingp(advancementGrid[nextRank]))
+        if (!compiledBonuses)
+        {
+            compileGuildTables();
+        }
+
+        if(member(compiledAdvancement, nextRank))
         {
             int rankAdvanced = 1;
-            string *criteriaToApply = m_indices(advancementGrid[nextRank]);
-            foreach(string criterion in criteriaToApply)
+            foreach(mapping criterion in compiledAdvancement[nextRank])
             {
-                rankAdvanced &&= applyAdvancementCriterion(
-                    advancementGrid[nextRank][criterion], guildMember);
+                rankAdvanced &&= applyAdvancementCriterion(criterion,
+                    guildMember);
             }
             if(rankAdvanced)
             {
@@ -875,70 +1018,27 @@ public nomask string demoteRank(object guildMember, string currentRank)
     return ret;
 }
 
-/////////////////////////////////////////////////////////////////////////////
-private nomask int isBonusAttack(string bonusItem)
-{
-    int ret = 0;
-    string attackType = 0;
-    if(bonusItem && stringp(bonusItem) && member(bonusGrid, bonusItem) &&
-       sscanf(bonusItem, "%s attack", attackType) && 
-       getDictionary("attacks"))
-    {
-        ret = (getDictionary("attacks")->getAttack(attackType) != 0) || 
-              (attackType == "weapon");
-    }
-    return ret;
-}
-
 /////////////////////////////////////////////////////////////////////////////
 public nomask mapping *getExtraAttacks(int level, string rank)
 {
     mapping *ret = ({ });
-    string *keys = filter(m_indices(bonusGrid), #'isBonusAttack);
-    string *ranks = m_indices(mkmapping(({ "default", rank })));
 
-    if(keys)
+    if (!compiledBonuses)
     {
-        foreach(string key in keys)
-        {
-            // attacksDictionary is verfied to exist via call to
-            // isBonusAttack
-            string attack = 0;
+        compileGuildTables();
+    }
 
-            if(sscanf(key, "%s attack", attack))
-            {
-                mapping attackMap =
-                    getDictionary("attacks")->getAttackMapping(attack,
-                    (member(criteriaMap[key], "base damage") ? 
-                    criteriaMap[key]["base damage"] : 1), 35);
+    foreach(string key, mapping attackTable in compiledAttacks)
+    {
+        int numAttacks = levelTotal(member(attackTable["ranks"], rank) ?
+            attackTable["ranks"][rank] : attackTable["unranked"], level);
 
-                foreach(string checkRank in ranks)
-                {
-                    for(int levelToApply = 1; levelToApply <= level; levelToApply++)
-                    {
-                        if(member(bonusGrid[key], checkRank) &&
-                           member(bonusGrid[key][checkRank], levelToApply))
-                        {
-                            for(int numAttacks = 1; 
-                                numAttacks <= bonusGrid[key][checkRank][levelToApply];
-                                numAttacks++)
-                            {
-                                ret += ({ attackMap });
-                            }
-                        }
-                    }
-                }
-                if(!member(criteriaMap[key], "begin at level") &&
-                    member(criteriaMap[key], "begin at rank") &&
-                    member(bonusGrid[key], rank))
-                {
-                    for(int numAttacks = 1; 
-                        numAttacks <= bonusGrid[key][rank][1];
-                        numAttacks++)
-                    {
-                        ret += ({ attackMap });
-                    }
-                }
+        if (numAttacks > 0)
+        {
+            mapping attackMap = attackTable["attack"] + ([ ]);
+            while (numAttacks--)
+            {
+                ret += ({ attackMap });
             }
         }
     }
@@ -777,7 +777,7 @@ public nomask int transferItemsTo(object destination)
             if(item && objectp(item) && !item->drop(Silently))
             {
                 ret += item->query("weight");
-                move_object(item, destination);
+                moveObject(item, destination);
             }
         }
     }
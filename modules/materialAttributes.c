@@ -20,6 +20,7 @@ public varargs string Name(string newName)
     if(newName && (!name || !function_exists("isPlayer", this_object())))
     {
         name = newName;
+        aliasesChanged();
     }
 
     return ghost ? "some mist" : capitalize(name);
@@ -286,6 +287,7 @@ public varargs string *Aliases(string *newAliases)
     if(newAliases && pointerp(newAliases))
     {
         aliases = newAliases;
+        aliasesChanged();
     }
     return aliases + ({ name });
 }
@@ -297,15 +299,22 @@ public nomask int addAlias(string newAlias)
     if(newAlias && stringp(newAlias) && (member(aliases, newAlias) < 0))
     {
         aliases += ({ newAlias });
+        aliasesChanged();
         ret = 1;
     }
     return ret;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+public string *targetAliases()
+{
+    return Aliases() + ({ RealName() });
+}
+
 /////////////////////////////////////////////////////////////////////////////
 public int id(string item)
 {
-    string *aliasCheck = Aliases() + ({ RealName() });
+    string *aliasCheck = targetAliases();
     
     return (item && stringp(item) && aliasCheck && (member(aliasCheck, item) > -1));
 }
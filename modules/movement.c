@@ -11,19 +11,35 @@ virtual inherit "/lib/core/thing.c";
 public nomask void runAway()
 {
     object originalLocation = environment();
-    if(originalLocation && function_exists("exits", originalLocation))
+    if(originalLocation)
     {
-        string *possibleDestinations = originalLocation->exits();
+        string *possibleDestinations = ({});
+
+        object navigation = getDictionary("navigation");
+        if (navigation)
+        {
+            possibleDestinations =
+                m_indices(navigation->exitsFrom(originalLocation));
+        }
+        if (!sizeof(possibleDestinations) &&
+            function_exists("exits", originalLocation))
+        {
+            possibleDestinations = originalLocation->exits() || ({});
+        }
         object materialAttributes = getService("materialAttributes");
         
-        if(possibleDestinations && materialAttributes &&
+        if(sizeof(possibleDestinations) && materialAttributes &&
             !materialAttributes->queryProperty("no fear"))
         {
+            // Each exit is only tried once - there's no point in running
+            // into the same locked door twice.
             int attemptsToRun = 0;
-            while((attemptsToRun < 12) && (originalLocation == environment()))
+            while(sizeof(possibleDestinations) && (attemptsToRun < 12) &&
+                (originalLocation == environment()))
             {
                 string direction = 
                     possibleDestinations[random(sizeof(possibleDestinations))];
+                possibleDestinations -= ({ direction });
                 command(direction);
                 attemptsToRun++;
             }
@@ -8,6 +8,10 @@
 virtual inherit "/lib/core/thing.c";
 #include "/lib/modules/secure/races.h"
 
+// bonus -> racial bonus for racialBonusRace
+private nosave mapping racialBonusTable = ([]);
+private nosave string racialBonusRace = 0;
+
 /////////////////////////////////////////////////////////////////////////////
 private nomask object racialDictionary()
 {
@@ -68,16 +72,34 @@ public nomask int racesAttributeBonus(string attribute)
 /////////////////////////////////////////////////////////////////////////////
 public nomask int racesBonusTo(string bonus)
 {
-    int ret = 0;
-    
-    if(function_exists(bonus, racialDictionary()))
+    // Racial bonuses only depend on the race, so they are looked up once
+    // per bonus and thrown away if the race changes.
+    if (racialBonusRace != Race())
     {
-        ret = call_other(racialDictionary(), bonus, Race());
+        racialBonusTable = ([]);
+        racialBonusRace = Race();
     }
-    else if(function_exists("BonusSkillModifier", racialDictionary()))
+
+    if (!member(racialBonusTable, bonus))
     {
-        ret = call_other(racialDictionary(), 
-            "BonusSkillModifier", Race(), bonus);
+        int ret = 0;
+        if(function_exists(bonus, racialDictionary()))
+        {
+            ret = call_other(racialDictionary(), bonus, Race());
+        }
+        else if(function_exists("BonusSkillModifier", racialDictionary()))
+        {
+            ret = call_other(racialDictionary(), 
+                "BonusSkillModifier", Race(), bonus);
+        }
+        racialBonusTable[bonus] = ret;
     }
-    return ret;
+    return racialBonusTable[bonus];
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask mapping racesBonusSources(string bonus)
+{
+    int amount = racesBonusTo(bonus);
+    return amount ? ([ Race(): amount ]) : ([]);
 }
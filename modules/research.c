@@ -109,6 +109,7 @@ public nomask varargs int activateSustainedResearch(object researchObj,
     {
         getService("combat")->spellAction(1);
         research[researchItem]["sustained active"] = 1;
+        activeSustainedResearch[researchItem] = 1;
         ret = 1;
         
         if(member(research[researchItem], "active modifier object") &&
@@ -138,6 +139,7 @@ public nomask int deactivateSustainedResearch(string researchItem)
        research[researchItem]["sustained active"])
     {
         m_delete(research[researchItem], "sustained active");
+        m_delete(activeSustainedResearch, researchItem);
         ret = 1;
         
         if(member(research[researchItem], "active modifier object") &&
@@ -383,6 +385,7 @@ public nomask varargs int initiateResearch(string researchItem)
         {
             research[researchItem]["bonuses"] = bonuses;
         }
+        researchBonusIndex = ([]);
         registerResearchEvents();
     }
     return ret;
@@ -572,70 +575,102 @@ public nomask int researchAttributeBonus(string attribute)
 }
 
 /////////////////////////////////////////////////////////////////////////////
-public nomask int researchBonusTo(string bonus)
+private nomask mapping compileResearchBonus(string bonus)
 {
-    int ret = 0;
-
-    if (member(({ "MaxHitPoints", "MaxSpellPoints",
-            "MaxStaminaPoints" }), bonus) > -1)
-    {
-        string *sustainedResearchActive = filter(m_indices(research),
-            (: (member(research[$1], "sustained active") &&
-               research[$1]["sustained active"]) :));
+    mapping ret = ([ "amounts": ([]), "limited": ([]) ]);
 
-        foreach(string researchItem in sustainedResearchActive)
-        {
-            ret -= call_other(researchDictionary(),
-                "applySustainedCostTo", researchItem, bonus);
-        }
-    }
+    int isBonusFunction = function_exists(bonus, researchDictionary()) != 0;
+    string bonusString = isBonusFunction ?
+        getDictionary("bonuses")->getBonusFromFunction(bonus) :
+        (function_exists("BonusSkillModifier", researchDictionary()) ?
+        "bonus " + bonus : 0);
 
-    if(function_exists(bonus, researchDictionary()))
+    if (bonusString)
     {
-        string bonusString = 
-            getDictionary("bonuses")->getBonusFromFunction(bonus);
-
         string *researchItems = filter(m_indices(research),
             (: (member(research[$1], "bonuses") &&
                 sizeof(regexp(research[$1]["bonuses"], $2))) :), bonusString);
 
         foreach(string researchItem in researchItems)
         {
-            if(canApplyResearchBonus(researchItem, bonus))
+            if (isBonusFunction)
+            {
+                ret["amounts"][researchItem] = 
+                    call_other(researchDictionary(), bonus, researchItem);
+            }
+            else if (researchDictionary()->researchEffectIsLimited(researchItem))
+            {
+                ret["amounts"][researchItem] = 0;
+                ret["limited"][researchItem] = 1;
+            }
+            else
             {
-                ret += call_other(researchDictionary(), bonus, researchItem);              
+                ret["amounts"][researchItem] = call_other(researchDictionary(),
+                    "BonusSkillModifier", researchItem, bonus);
             }
         }
     }
-    else if(function_exists("BonusSkillModifier", researchDictionary()))
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask mapping researchBonusEntry(string bonus)
+{
+    if (!member(researchBonusIndex, bonus))
     {
-        string *researchItems = filter(m_indices(research),
-            (: (member(research[$1], "bonuses") &&
-                sizeof(regexp(research[$1]["bonuses"], 
-                "bonus " + $2))) :), bonus);
+        researchBonusIndex[bonus] = compileResearchBonus(bonus);
+    }
+    return researchBonusIndex[bonus];
+}
 
-        foreach(string researchItem in researchItems)
+/////////////////////////////////////////////////////////////////////////////
+public nomask mapping researchBonusSources(string bonus)
+{
+    mapping ret = ([]);
+
+    if (sizeof(activeSustainedResearch) && (member(({ "MaxHitPoints",
+        "MaxSpellPoints", "MaxStaminaPoints" }), bonus) > -1))
+    {
+        foreach(string researchItem in m_indices(activeSustainedResearch))
+        {
+            ret[researchItem] = -call_other(researchDictionary(),
+                "applySustainedCostTo", researchItem, bonus);
+        }
+    }
+
+    mapping entry = researchBonusEntry(bonus);
+    foreach(string researchItem, int amount in entry["amounts"])
+    {
+        if (canApplyResearchBonus(researchItem, bonus))
         {
-            if(researchDictionary()->researchEffectIsLimited(researchItem) &&
-               canApplyResearchBonus(researchItem, bonus))
+            if (member(entry["limited"], researchItem))
             {
                 object target = this_object()->itemBeingCrafted() ?
                     this_object()->itemBeingCrafted() :
                     this_object()->getTargetToAttack();
 
-                ret += call_other(researchDictionary(), "LimitedSkillModifier",
-                    researchItem, bonus, this_object(), target);
-            }        
-            else if(canApplyResearchBonus(researchItem, bonus))
-            {
-                ret += call_other(researchDictionary(), "BonusSkillModifier", 
-                    researchItem, bonus);
-            }           
+                amount = call_other(researchDictionary(), 
+                    "LimitedSkillModifier", researchItem, bonus,
+                    this_object(), target);
+            }
+            ret[researchItem] += amount;
         }
     }
     return ret;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+public nomask int researchBonusTo(string bonus)
+{
+    int ret = 0;
+
+    foreach(string researchItem, int amount in researchBonusSources(bonus))
+    {
+        ret += amount;
+    }
+    return ret;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 public nomask int researchCommand(string command)
 {
@@ -709,6 +744,7 @@ static nomask void researchHeartBeat()
                 {
                     research[researchItem]["when research complete"] = time();
                     research[researchItem]["research complete"] = 1;
+                    researchBonusIndex = ([]);
 
                     object events = getService("events");
                     if (events && objectp(events))
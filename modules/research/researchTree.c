@@ -19,6 +19,21 @@ private string treeRoot;
 private mapping tree = ([
 ]);
 
+// The tree's layout is compiled the first time it is viewed and thrown
+// away whenever the tree changes: ({ ({ element, level, research object,
+// has children }) }) for each node reachable from the root, in the order
+// it is displayed.
+private nosave mixed *compiledNodes = 0;
+private nosave mapping compiledResearchTree = 0;
+
+// owner -> ([ "event count": <research events sent>,
+//             "status": ([ element: "researched"|"researching"|"" ]) ])
+// Each owner's research status for the tree's elements. Entries are looked
+// up as elements are viewed and cleared when the owner's research changes.
+private nosave mapping ownerStatus = ([]);
+private nosave string *ResearchEvents = ({ "onResearchStarted",
+    "onResearchCompleted", "onRestoreSucceeded" });
+
 /////////////////////////////////////////////////////////////////////////////
 public void reset(int arg)
 {
@@ -28,6 +43,9 @@ public void reset(int arg)
         description = "";
         treeRoot = 0;
         tree = ([]);
+        compiledNodes = 0;
+        compiledResearchTree = 0;
+        ownerStatus = ([]);
     }
 }
 
@@ -99,6 +117,7 @@ public nomask varargs string TreeRoot(string newRoot)
         if(getResearchItem(newRoot))
         {
             treeRoot = newRoot;
+            compiledNodes = 0;
         }
         else
         {
@@ -117,10 +136,9 @@ public nomask int prerequisitesMetFor(string researchItem, object owner)
     if(researchItem && stringp(researchItem) && owner && objectp(owner) &&
        function_exists("isResearched", owner) && member(tree, researchItem))
     {
-        object research = getResearchItem(researchItem);
-        ret = checkPrerequisites(owner) && research &&
-            research->checkPrerequisites(owner);
-
+        // Most of a tree is usually out of reach, so the parents are
+        // checked before the more expensive prerequisites.
+        ret = 1;
         string *dependencies = tree[researchItem]["parents"];
         if(dependencies && pointerp(dependencies) && sizeof(dependencies))
         {
@@ -129,13 +147,19 @@ public nomask int prerequisitesMetFor(string researchItem, object owner)
                 ret &&= owner->isResearched(dependency);
             }
         }
+
+        if (ret)
+        {
+            object research = getResearchItem(researchItem);
+            ret = checkPrerequisites(owner) && research &&
+                research->checkPrerequisites(owner);
+        }
     }
     return ret;
 }
 
 /////////////////////////////////////////////////////////////////////////////
-private nomask varargs mapping getTreeNode(string element, object owner, 
-    int addDetails)
+private nomask mapping getTreeNode(string element)
 {
     mapping ret = ([ ]);
 
@@ -145,7 +169,7 @@ private nomask varargs mapping getTreeNode(string element, object owner,
         object researchItem = getResearchItem(element);
         if(!tree[element]["children"])
         {
-            ret[researchItem] = addDetails ? ([]) : 0;
+            ret[researchItem] = 0;
         }
         else if(pointerp(tree[element]["children"]) && 
                 sizeof(tree[element]["children"]) &&
@@ -154,58 +178,143 @@ private nomask varargs mapping getTreeNode(string element, object owner,
             ret[researchItem] = ([ ]);
             foreach(string child in tree[element]["children"])
             {
-                object childItem = getResearchItem(child);
-
-                if (addDetails)
-                {
-                    ret += getTreeNode(child, owner, 1);
-                }
-                else
-                {
-                    ret[researchItem] += getTreeNode(child, owner);
-                }
+                ret[researchItem] += getTreeNode(child);
             }
         }
+    }
+    return ret + ([ ]);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask mixed *compileNodes(string element, int level)
+{
+    mixed *ret = ({});
 
-        if (addDetails && owner && objectp(owner))
+    if(element && stringp(element) && member(tree, element))
+    {
+        object researchItem = getResearchItem(element);
+        if (researchItem)
         {
-            if (owner->isResearched(element))
-            {
-                ret[researchItem] += (["researched":1]);
-            }
-            else if (owner->isResearching(element))
+            if(!tree[element]["children"])
             {
-                ret[researchItem] += (["researching":1]);
+                ret += ({ ({ element, level, researchItem, 0 }) });
             }
-            else if (prerequisitesMetFor(element, owner))
+            else if(pointerp(tree[element]["children"]) &&
+                sizeof(tree[element]["children"]) &&
+                stringp(tree[element]["children"][0]))
             {
-                ret[researchItem] += (["can research":1]);
+                ret += ({ ({ element, level, researchItem, 1 }) });
+                foreach(string child in tree[element]["children"])
+                {
+                    ret += compileNodes(child, level + 1);
+                }
             }
         }
     }
-    return ret + ([ ]);
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask mixed *treeNodes()
+{
+    // Updating a research item destructs the compiled object, so those
+    // have to be picked up again.
+    if (!compiledNodes || 
+        sizeof(filter(compiledNodes, (: !objectp($1[2]) :))))
+    {
+        compiledNodes = (treeRoot && stringp(treeRoot)) ?
+            compileNodes(treeRoot, 0) : ({});
+        compiledResearchTree = 0;
+    }
+    return compiledNodes;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int definedIn(string method, object owner, string program)
+{
+    string source = function_exists(method, owner);
+    if (source && (source[0] == '/'))
+    {
+        source = source[1..];
+    }
+    return source == program;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask string researchStatus(string element, object owner)
+{
+    string ret = 0;
+    mapping status = 0;
+
+    // Only the research module is known to send an event whenever an
+    // owner's research changes.
+    if (definedIn("eventCount", owner, "lib/core/events.c") &&
+        definedIn("isResearched", owner, "lib/modules/research.c"))
+    {
+        int eventCount = owner->eventCount(ResearchEvents);
+        if (!member(ownerStatus, owner) ||
+            (ownerStatus[owner]["event count"] != eventCount))
+        {
+            ownerStatus[owner] = ([ "event count": eventCount,
+                "status": ([]) ]);
+        }
+        status = ownerStatus[owner]["status"];
+        ret = status[element];
+    }
+
+    if (!ret)
+    {
+        ret = owner->isResearched(element) ? "researched" :
+            (owner->isResearching(element) ? "researching" : "");
+
+        if (status)
+        {
+            status[element] = ret;
+        }
+    }
+    return ret;
 }
 
 /////////////////////////////////////////////////////////////////////////////
 public nomask varargs mapping getResearchTree(object owner)
 {
-    mapping ret = ([ ]);
-    if(treeRoot && stringp(treeRoot))
+    treeNodes();
+    if (!compiledResearchTree)
     {
-        ret += getTreeNode(treeRoot, owner);
+        compiledResearchTree = ([ ]);
+        if(treeRoot && stringp(treeRoot))
+        {
+            compiledResearchTree += getTreeNode(treeRoot);
+        }
     }
-    return ret + ([ ]);
+    return deep_copy(compiledResearchTree);
 }
 
 /////////////////////////////////////////////////////////////////////////////
 public nomask varargs mapping getFlattenedResearchTree(object owner)
 {
     mapping ret = ([]);
-    if (treeRoot && stringp(treeRoot))
+    foreach(mixed *node in treeNodes())
     {
-        ret += getTreeNode(treeRoot, owner, 1);
+        if (!member(ret, node[2]))
+        {
+            mapping details = ([]);
+            if (owner && objectp(owner))
+            {
+                string status = researchStatus(node[0], owner);
+                if (sizeof(status))
+                {
+                    details[status] = 1;
+                }
+                else if (prerequisitesMetFor(node[0], owner))
+                {
+                    details["can research"] = 1;
+                }
+            }
+            ret[node[2]] = details;
+        }
     }
-    return ret + ([]);
+    return ret;
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -247,6 +356,7 @@ public nomask int addChild(string child, string parent)
         {
             tree[child]["parents"] += ({ parent });
             tree[parent]["children"] += ({ child });
+            compiledNodes = 0;
         }
         else
         {
@@ -277,6 +387,7 @@ public nomask int addResearchElement(string location)
                 "parents": 0,
                 "children": 0
             ]);
+            compiledNodes = 0;
             ret = 1;
         }
         else
@@ -309,64 +420,27 @@ public nomask string *getParents(string researchItem)
 }
 
 /////////////////////////////////////////////////////////////////////////////
-private nomask string getNodeInfo(string element, object owner,
-    int level)
+private nomask string getNodeInfo(mixed *node, object owner)
 {
-    string ret = "";
-
-    if (element && stringp(element) && member(tree, element) &&
-        researchDictionary()->researchObject(element))
+    string displayColor = "\x1b[0;31m";
+    string status = researchStatus(node[0], owner);
+    if (status == "researched")
     {
-        object researchItem = getResearchItem(element);
-        if (!tree[element]["children"])
-        {
-            string displayColor = "\x1b[0;31m";
-            if (owner->isResearched(element))
-            {
-                displayColor = "\x1b[0;34;1m";
-            }
-            else if (owner->isResearching(element))
-            {
-                displayColor = "\x1b[0;35m";
-            }
-            else if (owner->canResearch(element))
-            {
-                displayColor = "\x1b[0;33m";
-            }
-            ret += sprintf("\x1b[0;30;1m%" + (level * 6) + "s%s%s\x1b[0m\n",
-                "|-- ", 
-                displayColor, 
-                capitalize(researchItem->query("name")));
-        }
-        else if (pointerp(tree[element]["children"]) &&
-            sizeof(tree[element]["children"]) &&
-            stringp(tree[element]["children"][0]))
-        {
-            string displayColor = "\x1b[0;31m";
-            if (owner->isResearched(element))
-            {
-                displayColor = "\x1b[0;34;1m";
-            }
-            else if (owner->isResearching(element))
-            {
-                displayColor = "\x1b[0;35m";
-            }
-            else if (owner->canResearch(element))
-            {
-                displayColor = "\x1b[0;33m";
-            }
-            researchItem = getResearchItem(element);
-            ret += sprintf("\x1b[0;30;1m%" + (level * 6) + "s%s%s\x1b[0m\n", 
-                (level ? "|-- " : ""), 
-                displayColor,
-                capitalize(researchItem->query("name")));
-            foreach(string child in tree[element]["children"])
-            {
-                ret += getNodeInfo(child, owner, level + 1);
-            }
-        }
+        displayColor = "\x1b[0;34;1m";
     }
-    return ret;
+    else if (status == "researching")
+    {
+        displayColor = "\x1b[0;35m";
+    }
+    else if (owner->canResearch(node[0]))
+    {
+        displayColor = "\x1b[0;33m";
+    }
+
+    return sprintf("\x1b[0;30;1m%" + (node[1] * 6) + "s%s%s\x1b[0m\n",
+        ((node[1] || !node[3]) ? "|-- " : ""),
+        displayColor,
+        capitalize(node[2]->query("name")));
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -379,7 +453,10 @@ public nomask string researchTreeDetails(object user)
 
     if (treeRoot)
     {
-        ret += getNodeInfo(treeRoot, user, 0);
+        foreach(mixed *node in treeNodes())
+        {
+            ret += getNodeInfo(node, user);
+        }
     }
     return ret;
 }
\ No newline at end of file
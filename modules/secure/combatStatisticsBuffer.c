@@ -0,0 +1,107 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+
+// Kills that have not been written yet, by player name. They are kept here
+// rather than on the player so that a player who is destructed without
+// being saved - link death, a runtime error, a wizard's destruct - does not
+// take them along. A player's kills are written when that player is saved
+// or restored or once FlushThreshold of them have accumulated. Everything
+// else is written every FlushInterval seconds.
+//   name -> ([ "kills": ([ foe key: ([ "name", "level", "times killed" ]) ]),
+//              "races": ([ race: times killed ]), "count": kills ])
+private nosave int FlushThreshold = 10;
+private nosave int FlushInterval = 60;
+private nosave mapping pendingKills = ([]);
+private nosave object dataAccess;
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask object DataAccess()
+{
+    if (!dataAccess)
+    {
+        dataAccess = clone_object("/lib/modules/secure/dataAccess.c");
+    }
+    return dataAccess;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void writeKills(string name)
+{
+    if (member(pendingKills, name))
+    {
+        mapping kills = pendingKills[name];
+        m_delete(pendingKills, name);
+
+        DataAccess()->saveBufferedCombatStatistics(name, kills["kills"],
+            kills["races"]);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+static nomask void writeAllKills()
+{
+    foreach(string name in m_indices(pendingKills))
+    {
+        writeKills(name);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void addKill(string name, string foeKey, string foeName,
+    int foeLevel, string race)
+{
+    if (canAccessDatabase(previous_object()))
+    {
+        if (!member(pendingKills, name))
+        {
+            pendingKills[name] = ([ "kills": ([]), "races": ([]), "count": 0 ]);
+        }
+        mapping kills = pendingKills[name];
+
+        if (!member(kills["kills"], foeKey))
+        {
+            kills["kills"][foeKey] = ([
+                "name": foeName,
+                "level": foeLevel,
+                "times killed": 0
+            ]);
+        }
+        kills["kills"][foeKey]["times killed"]++;
+
+        if (race)
+        {
+            kills["races"][race]++;
+        }
+
+        kills["count"]++;
+        if (kills["count"] >= FlushThreshold)
+        {
+            writeKills(name);
+        }
+        else if (find_call_out("writeAllKills") < 0)
+        {
+            call_out("writeAllKills", FlushInterval);
+        }
+    }
+    else
+    {
+        write("This is where a stern message about trying to circumvent "
+            "security should probably go: " + program_name(previous_object()) + "\n");
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void flushKills(string name)
+{
+    if (canAccessDatabase(previous_object()))
+    {
+        writeKills(name);
+    }
+    else
+    {
+        write("This is where a stern message about trying to circumvent "
+            "security should probably go: " + program_name(previous_object()) + "\n");
+    }
+}
@@ -17,6 +17,80 @@ virtual inherit "/lib/modules/secure/dataServices/wizardDataService.c";
 virtual inherit "/lib/modules/secure/dataServices/conversationsDataService.c";
 virtual inherit "/lib/modules/secure/dataServices/stateDataService.c";
 
+/////////////////////////////////////////////////////////////////////////////
+private nomask mapping loadPlayerData(string name)
+{
+    mapping data = (["name":name]);
+
+    int dbHandle = connect();
+    data += getBasicPlayerData(name, dbHandle);
+
+    if (member(data, "playerId"))
+    {
+        data += getGuildData(data["playerId"], dbHandle);
+        data += getMaterialAttributes(data["playerId"], dbHandle);
+        data += getQuestData(data["playerId"], dbHandle);
+        data += getResearch(data["playerId"], dbHandle);
+        data += getResearchChoices(data["playerId"], dbHandle);
+        data += getOpenResearchTrees(data["playerId"], dbHandle);
+        data += getSkills(data["playerId"], dbHandle);
+        data += getTraits(data["playerId"], dbHandle);
+        data += getTemporaryTraits(data["playerId"], dbHandle);
+        data += getInventory(data["playerId"], dbHandle);
+        data += getFactions(data["playerId"], dbHandle);
+        data += getWizardLevel(data["playerId"], dbHandle);
+        data += getCombatStatistics(data["playerId"], dbHandle);
+    }
+
+    disconnect(dbHandle);
+    return data + ([]);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void storePlayerData(mapping playerData)
+{
+    int dbHandle = connect();
+    int playerId = saveBasicPlayerData(dbHandle, playerData);
+    saveBiologicalData(dbHandle, playerId, playerData);
+    saveCombatData(dbHandle, playerId, playerData);
+    saveMaterialAttributes(dbHandle, playerId, playerData);
+    saveGuildData(dbHandle, playerId, playerData);
+    saveQuestData(dbHandle, playerId, playerData);
+    saveResearch(dbHandle, playerId, playerData);
+    saveResearchChoices(dbHandle, playerId, playerData);
+    saveOpenResearchTrees(dbHandle, playerId, playerData);
+    saveSkills(dbHandle, playerId, playerData);
+    saveTraits(dbHandle, playerId, playerData);
+    saveInventory(dbHandle, playerId, playerData);
+    saveFactions(dbHandle, playerId, playerData);
+    saveWizardLevel(dbHandle, playerId, playerData);
+    disconnect(dbHandle);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask string loadPlayerType(string name)
+{
+    string ret = "player";
+
+    string query = sprintf("select wizardTypes.type from wizards "
+        "inner join wizardTypes on wizards.typeId = wizardTypes.id "
+        "inner join players on wizards.playerid = players.id "
+        "where players.name = '%s'", sanitizeString(name));
+
+    int dbHandle = connect();
+
+    executeQuery(dbHandle, query);
+
+    mixed result = fetchResult(dbHandle);
+    disconnect(dbHandle);
+
+    if (result)
+    {
+        ret = result[0];
+    }
+    return ret;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 public nomask mapping getPlayerData(string name)
 {
@@ -24,58 +98,57 @@ public nomask mapping getPlayerData(string name)
 
     if (canAccessDatabase(previous_object()))
     {
-        int dbHandle = connect();
-        data += getBasicPlayerData(name, dbHandle);
+        data = loadPlayerData(name);
+    }
+    else
+    {
+        write("This is where a stern message about trying to circumvent "
+            "security should probably go: " + program_name(previous_object()) + "\n");
+    }
+    return data + ([]);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void getPlayerDataAsync(string name, closure callback)
+{
+    if (canAccessDatabase(previous_object()))
+    {
+        runOperation(#'loadPlayerData, ({ name }), callback);
+    }
+    else
+    {
+        write("This is where a stern message about trying to circumvent "
+            "security should probably go: " + program_name(previous_object()) + "\n");
+    }
+}
 
-        if (member(data, "playerId"))
+/////////////////////////////////////////////////////////////////////////////
+public nomask void savePlayerData(mapping playerData)
+{
+    if (canAccessDatabase(previous_object()))
+    {
+        if (member(playerData, "name"))
         {
-            data += getGuildData(data["playerId"], dbHandle);
-            data += getMaterialAttributes(data["playerId"], dbHandle);
-            data += getQuestData(data["playerId"], dbHandle);
-            data += getResearch(data["playerId"], dbHandle);
-            data += getResearchChoices(data["playerId"], dbHandle);
-            data += getOpenResearchTrees(data["playerId"], dbHandle);
-            data += getSkills(data["playerId"], dbHandle);
-            data += getTraits(data["playerId"], dbHandle);
-            data += getTemporaryTraits(data["playerId"], dbHandle);
-            data += getInventory(data["playerId"], dbHandle);
-            data += getFactions(data["playerId"], dbHandle);
-            data += getWizardLevel(data["playerId"], dbHandle);
+            storePlayerData(playerData);
         }
-
-        disconnect(dbHandle);
     }
     else
     {
         write("This is where a stern message about trying to circumvent "
             "security should probably go: " + program_name(previous_object()) + "\n");
     }
-    return data + ([]);
 }
 
 /////////////////////////////////////////////////////////////////////////////
-public nomask void savePlayerData(mapping playerData)
+public nomask varargs void savePlayerDataAsync(mapping playerData,
+    closure callback)
 {
     if (canAccessDatabase(previous_object()))
     {
         if (member(playerData, "name"))
         {
-            int dbHandle = connect();
-            int playerId = saveBasicPlayerData(dbHandle, playerData);
-            saveBiologicalData(dbHandle, playerId, playerData);
-            saveCombatData(dbHandle, playerId, playerData);
-            saveMaterialAttributes(dbHandle, playerId, playerData);
-            saveGuildData(dbHandle, playerId, playerData);
-            saveQuestData(dbHandle, playerId, playerData);
-            saveResearch(dbHandle, playerId, playerData);
-            saveResearchChoices(dbHandle, playerId, playerData);
-            saveOpenResearchTrees(dbHandle, playerId, playerData);
-            saveSkills(dbHandle, playerId, playerData);
-            saveTraits(dbHandle, playerId, playerData);
-            saveInventory(dbHandle, playerId, playerData);
-            saveFactions(dbHandle, playerId, playerData);
-            saveWizardLevel(dbHandle, playerId, playerData);
-            db_close(dbHandle);
+            runOperation(#'storePlayerData, ({ deep_copy(playerData) }),
+                callback);
         }
     }
     else
@@ -88,23 +161,11 @@ public nomask void savePlayerData(mapping playerData)
 /////////////////////////////////////////////////////////////////////////////
 public nomask string playerType(string name)
 {
-    string ret = "player";
-
-    string query = sprintf("select wizardTypes.type from wizards "
-        "inner join wizardTypes on wizards.typeId = wizardTypes.id "
-        "inner join players on wizards.playerid = players.id "
-        "where players.name = '%s'", sanitizeString(name));
-
-    int dbHandle = connect();
-
-    db_exec(dbHandle, query);
-
-    mixed result = db_fetch(dbHandle);
-    disconnect(dbHandle);
+    return loadPlayerType(name);
+}
 
-    if (result)
-    {
-        ret = result[0];
-    }
-    return ret;
+/////////////////////////////////////////////////////////////////////////////
+public nomask void playerTypeAsync(string name, closure callback)
+{
+    runOperation(#'loadPlayerType, ({ name }), callback);
 }
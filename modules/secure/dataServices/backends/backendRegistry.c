@@ -0,0 +1,48 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+private nosave mapping Backends = ([
+    "mysql": "/lib/modules/secure/dataServices/backends/mySqlBackend.c",
+    "postgres": "/lib/modules/secure/dataServices/backends/postgresBackend.c",
+    "sqlite": "/lib/modules/secure/dataServices/backends/sqliteBackend.c"
+]);
+
+private string backend = "mysql";
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask object activeBackend()
+{
+    return load_object(Backends[backend]);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask string activeBackendName()
+{
+    return backend;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask int activeBackendIsAsynchronous()
+{
+    return activeBackend()->isAsynchronous();
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask string *availableBackends()
+{
+    return sort_array(m_indices(Backends), (: $1 > $2 :));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask int useBackend(string name)
+{
+    int ret = 0;
+
+    if (canAccessDatabase(previous_object()) && member(Backends, name))
+    {
+        backend = name;
+        ret = 1;
+    }
+    return ret;
+}
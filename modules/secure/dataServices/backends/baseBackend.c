@@ -0,0 +1,137 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+
+// Every data access backend must implement the following. Handles are
+// opaque to the data services - they are only ever passed back to the
+// backend that issued them.
+public int connect();
+public void disconnect(int handle);
+public void executeQuery(int handle, string query);
+public mixed fetchResult(int handle);
+public void callProcedure(int handle, string procedure, mixed *arguments);
+public mixed callFunction(int handle, string functionName,
+    mixed *arguments);
+public string sanitizeString(string value);
+
+private nosave int statementCount = 0;
+private nosave int requestCount = 0;
+private nosave string SecureDirectory = "lib/modules/secure/";
+private nosave string DataService = 
+    "lib/modules/secure/dataServices/dataService.c";
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask string programName(string program)
+{
+    return (program && (program[0] == '/')) ? program[1..] : program;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int isDataService(object caller)
+{
+    string program = programName(program_name(caller));
+
+    return (sizeof(program) > sizeof(SecureDirectory)) &&
+        (program[0..(sizeof(SecureDirectory) - 1)] == SecureDirectory) &&
+        (member(map(inherit_list(caller), #'programName), DataService) > -1);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+protected nomask void verifyAccess()
+{
+    // Backends run raw SQL, so only the data services in the secure
+    // directory and objects trusted with the database may use them. The
+    // data services guard their own public methods with canAccessDatabase.
+    object caller = previous_object();
+
+    if (!caller || ((caller != this_object()) && !isDataService(caller) &&
+        !canAccessDatabase(caller)))
+    {
+        raise_error(sprintf("ERROR in baseBackend.c: %s is not allowed to "
+            "access the database.\n", caller ? program_name(caller) : "0"));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+protected void abandonSessions()
+{
+    // Backends that hold state between connect and disconnect override this
+    // to discard it when an operation fails part way through.
+}
+
+/////////////////////////////////////////////////////////////////////////////
+protected nomask void recordStatement()
+{
+    statementCount++;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask int statementsExecuted()
+{
+    // Running total of the statements this backend has sent to the
+    // database. Callers interested in a single operation take the difference.
+    // Backends that emulate stored procedures count each statement inside
+    // them, so this is not comparable across backends - requestsMade is.
+    return statementCount;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+protected nomask void recordRequest()
+{
+    requestCount++;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask int requestsMade()
+{
+    // Running total of the queries, procedures and functions the data
+    // services have asked this backend for, each counted once however
+    // the backend carries it out.
+    return requestCount;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public int isAsynchronous()
+{
+    // Asynchronous backends only return data to operations started with
+    // runOperation - anything that reads the database outside of one fails.
+    return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public void runOperation(closure operation, mixed *arguments,
+    closure callback)
+{
+    // Synchronous backends have the data on hand as soon as the operation
+    // returns, so the callback is made immediately. The callback receives the
+    // operation's result followed by the arguments it was run with.
+    verifyAccess();
+
+    mixed result;
+    string error = catch (result = apply(operation, arguments); nolog);
+    if (error)
+    {
+        abandonSessions();
+        raise_error((error[0] == '*') ? error[1..] : error);
+    }
+
+    if (callback)
+    {
+        apply(callback, result, arguments);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+protected nomask string formatArgument(mixed argument)
+{
+    return stringp(argument) ? 
+        sprintf("'%s'", sanitizeString(argument)) :
+        sprintf("%d", to_int(argument));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+protected nomask string formatArguments(mixed *arguments)
+{
+    return implode(map(arguments, #'formatArgument), ",");
+}
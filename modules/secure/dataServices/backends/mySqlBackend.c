@@ -0,0 +1,88 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+inherit "/lib/modules/secure/dataServices/backends/baseBackend.c";
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask int connect()
+{
+    verifyAccess();
+
+    int ret = 0;
+
+    if (!sizeof(db_handles()))
+    {
+        ret = db_connect(RealmsDatabase());
+    }
+    else
+    {
+        ret = db_handles()[0];
+    }
+    if (db_error(ret))
+    {
+        raise_error(db_error(ret));
+    }
+
+    if (ret)
+    {
+        db_exec(ret, "use " + RealmsDatabase() + ";");
+    }
+
+    while (db_fetch(ret));
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void disconnect(int handle)
+{
+    verifyAccess();
+    while(db_fetch(handle));
+    db_close(handle);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void executeQuery(int handle, string query)
+{
+    verifyAccess();
+    recordRequest();
+    recordStatement();
+    db_exec(handle, query);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask mixed fetchResult(int handle)
+{
+    verifyAccess();
+    return db_fetch(handle);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void callProcedure(int handle, string procedure, 
+    mixed *arguments)
+{
+    verifyAccess();
+    recordRequest();
+    recordStatement();
+    db_exec(handle, sprintf("call %s(%s);", procedure,
+        formatArguments(arguments)));
+    mixed result = db_fetch(handle);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask mixed callFunction(int handle, string functionName,
+    mixed *arguments)
+{
+    verifyAccess();
+    recordRequest();
+    recordStatement();
+    db_exec(handle, sprintf("select %s(%s);", functionName,
+        formatArguments(arguments)));
+    return db_fetch(handle);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public string sanitizeString(string value)
+{
+    return db_conv_string(value || "");
+}
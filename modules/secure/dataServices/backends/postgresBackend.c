@@ -0,0 +1,374 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+#include <pgsql.h>
+
+inherit "/lib/modules/secure/dataServices/backends/baseBackend.c";
+
+// The pg_* efuns never block: queries are sent down this object's single
+// connection (in order) and the results show up later in onDatabaseEvent.
+// The data services, however, are written as straight-line code that
+// expects a query's rows to be available as soon as it is executed. To
+// bridge the two, runOperation replays the operation every time a batch of
+// results arrives:
+//   - Reads are cached by query text and the number of writes the pass has
+//     made before them, so a read repeated after one of the operation's own
+//     writes is sent again rather than answered with the rows from before
+//     the write. A read that misses the cache is sent and the pass is marked
+//     as waiting. Other reads keep going so that independent queries are all
+//     sent together.
+//   - Writes are journaled in the order the operation makes them. Replays
+//     skip anything already journaled, so every write is sent exactly once.
+//     Once a pass is waiting, no further writes are sent since they may
+//     depend on a result that has not arrived yet.
+// When a pass finishes without waiting on anything and all of its writes
+// have completed, the operation's result is handed to the callback.
+private nosave int isConnected = 0;
+private nosave int nextHandle = 1;
+private nosave int currentHandle = 0;
+private nosave mapping sessions = ([]);
+private nosave mapping pendingQueries = ([]);
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void completeSession(int handle, mixed result)
+{
+    mapping session = sessions[handle];
+    m_delete(sessions, handle);
+
+    if (session["callback"])
+    {
+        apply(session["callback"], result, session["arguments"]);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void failSession(int handle, string error)
+{
+    mapping session = sessions[handle];
+    m_delete(sessions, handle);
+
+    debug_message(sprintf("postgresBackend: %s(%O) failed: %s\n",
+        to_string(session["operation"]), session["arguments"], error), 0x5);
+
+    // Callers must be able to tell a failed operation from one that found
+    // nothing, so the failure is handed back in place of the result.
+    if (session["callback"])
+    {
+        apply(session["callback"], ([ "database error": error ]),
+            session["arguments"]);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void runPass(int handle)
+{
+    mapping session = sessions[handle];
+    session["waiting"] = 0;
+    session["write index"] = 0;
+    session["rows"] = ({});
+
+    mixed result;
+    currentHandle = handle;
+    string error = catch (result = apply(session["operation"],
+        session["arguments"]); nolog);
+    currentHandle = 0;
+
+    if (error)
+    {
+        failSession(handle, error);
+    }
+    else if (!session["waiting"])
+    {
+        session["complete"] = 1;
+        session["result"] = result;
+
+        if (!session["outstanding"])
+        {
+            completeSession(handle, result);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+protected void ensureConnection()
+{
+    if (!isConnected)
+    {
+        pg_connect(sprintf("dbname=%s", RealmsDatabase()),
+            "onDatabaseEvent");
+        isConnected = 1;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+protected int submitQuery(string query)
+{
+    ensureConnection();
+    return pg_query(query, PG_RESULT_ARRAY);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void sendQuery(int handle, string query, mixed key)
+{
+    // Replays only send what has not been sent before, so every request is
+    // counted once here.
+    recordRequest();
+    recordStatement();
+    int id = submitQuery(query);
+
+    if (handle)
+    {
+        sessions[handle]["outstanding"]++;
+    }
+    pendingQueries[id] = ({ handle, key });
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask mixed *resultRows(mixed result)
+{
+    // The first row of an array result holds the column names.
+    return (pointerp(result) && sizeof(result)) ? result[1..] : ({});
+}
+
+/////////////////////////////////////////////////////////////////////////////
+static void onDatabaseEvent(int type, mixed result, int id)
+{
+    if (type == PGCONN_FAILED)
+    {
+        isConnected = 0;
+        foreach(int handle in m_indices(sessions))
+        {
+            failSession(handle, "Could not connect to the database.");
+        }
+        pendingQueries = ([]);
+    }
+    else if (member(pendingQueries, id))
+    {
+        int handle = pendingQueries[id][0];
+        mixed key = pendingQueries[id][1];
+        m_delete(pendingQueries, id);
+
+        if (handle && member(sessions, handle))
+        {
+            mapping session = sessions[handle];
+            session["outstanding"]--;
+
+            if ((type == PGRES_BAD_RESPONSE) || (type == PGRES_FATAL_ERROR))
+            {
+                failSession(handle,
+                    stringp(result) ? result : "Query failed.");
+            }
+            else
+            {
+                mixed *rows = resultRows(result);
+                if (stringp(key))
+                {
+                    session["reads"][key] = rows;
+                }
+                else
+                {
+                    session["writes"][key][1] = sizeof(rows) ? rows[0] : 0;
+                    session["writes"][key][2] = 1;
+                }
+
+                if (!session["outstanding"])
+                {
+                    if (session["complete"])
+                    {
+                        completeSession(handle, session["result"]);
+                    }
+                    else
+                    {
+                        runPass(handle);
+                    }
+                }
+            }
+        }
+        else if ((type == PGRES_BAD_RESPONSE) || (type == PGRES_FATAL_ERROR))
+        {
+            debug_message(sprintf("postgresBackend: %O\n", result), 0x5);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask mixed journalWrite(int handle, string statement)
+{
+    mixed ret = 0;
+
+    if (handle && member(sessions, handle))
+    {
+        mapping session = sessions[handle];
+        int index = session["write index"];
+        session["write index"]++;
+
+        if (index < sizeof(session["writes"]))
+        {
+            if (session["writes"][index][0] != statement)
+            {
+                raise_error("postgresBackend: Operation is not "
+                    "deterministic across replays.\n");
+            }
+            else if (session["writes"][index][2])
+            {
+                ret = session["writes"][index][1];
+            }
+            else
+            {
+                session["waiting"] = 1;
+            }
+        }
+        else if (!session["waiting"])
+        {
+            session["writes"] += ({ ({ statement, 0, 0 }) });
+            sendQuery(handle, statement, index);
+        }
+    }
+    else
+    {
+        sendQuery(0, statement, 0);
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask int isAsynchronous()
+{
+    return 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void runOperation(closure operation, mixed *arguments,
+    closure callback)
+{
+    verifyAccess();
+
+    int handle = nextHandle++;
+    sessions[handle] = ([
+        "operation": operation,
+        "arguments": arguments,
+        "callback": callback,
+        "reads": ([]),
+        "writes": ({}),
+        "outstanding": 0,
+        "complete": 0
+    ]);
+    runPass(handle);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask int connect()
+{
+    verifyAccess();
+
+    ensureConnection();
+    return currentHandle;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void disconnect(int handle)
+{
+    verifyAccess();
+
+    if (handle && member(sessions, handle))
+    {
+        sessions[handle]["rows"] = ({});
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void executeQuery(int handle, string query)
+{
+    verifyAccess();
+
+    if (handle && member(sessions, handle))
+    {
+        mapping session = sessions[handle];
+        session["rows"] = ({});
+        string key = sprintf("%d:%s", session["write index"], query);
+
+        if (member(session["reads"], key))
+        {
+            if (pointerp(session["reads"][key]))
+            {
+                session["rows"] = session["reads"][key];
+            }
+            else
+            {
+                session["waiting"] = 1;
+            }
+        }
+        else if (session["write index"] > sizeof(session["writes"]))
+        {
+            // A write before this read has not been sent yet, so sending
+            // the read now would return rows from before that write.
+            session["waiting"] = 1;
+        }
+        else
+        {
+            session["reads"][key] = 0;
+            session["waiting"] = 1;
+            sendQuery(handle, query, key);
+        }
+    }
+    else
+    {
+        sendQuery(0, query, 0);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask mixed fetchResult(int handle)
+{
+    verifyAccess();
+
+    mixed ret = 0;
+
+    if (!handle || !member(sessions, handle))
+    {
+        raise_error("postgresBackend: Query results are only available to "
+            "operations started with runOperation.\n");
+    }
+
+    mapping session = sessions[handle];
+    if (sizeof(session["rows"]))
+    {
+        ret = session["rows"][0];
+        session["rows"] = session["rows"][1..];
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void callProcedure(int handle, string procedure, mixed *arguments)
+{
+    verifyAccess();
+
+    journalWrite(handle, sprintf("select %s(%s);", procedure,
+        formatArguments(arguments)));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask mixed callFunction(int handle, string functionName,
+    mixed *arguments)
+{
+    verifyAccess();
+
+    if (!handle || !member(sessions, handle))
+    {
+        raise_error("postgresBackend: Function results are only available "
+            "to operations started with runOperation.\n");
+    }
+
+    mixed result = journalWrite(handle, sprintf("select %s(%s);",
+        functionName, formatArguments(arguments)));
+
+    return pointerp(result) ? result : ({ 0 });
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public string sanitizeString(string value)
+{
+    return pg_conv_string(value || "");
+}
@@ -0,0 +1,634 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+#include <debug_info.h>
+
+inherit "/lib/modules/secure/dataServices/backends/baseBackend.c";
+
+private nosave string DatabaseFile = "/lib/modules/secure/realms.sqlite";
+
+// SQLite databases are bound to the object that opened them, so this
+// blueprint owns the single connection and hands out a constant handle.
+private nosave int Handle = 1;
+private nosave int isOpen = 0;
+private nosave int openSessions = 0;
+private nosave int sessionEvaluation = 0;
+private nosave mixed *pendingRows = ({});
+
+private nosave mapping procedures = 0;
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask mixed *execute(string statement, mixed *arguments)
+{
+    recordStatement();
+    return apply(#'sl_exec, statement, arguments || ({})) || ({});
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask mixed selectValue(string statement, mixed *arguments)
+{
+    mixed *result = execute(statement, arguments);
+    return sizeof(result) ? result[0][0] : 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask string *columnList(string *columns, string format)
+{
+    return map(columns, (: sprintf($2, $1) :), format);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int findId(string table, mapping keys)
+{
+    string *columns = m_indices(keys);
+
+    return selectValue(sprintf("select id from %s where %s;", table,
+        implode(columnList(columns, "\"%s\" = ?"), " and ")),
+        map(columns, (: $2[$1] :), keys));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int insert(string table, mapping values)
+{
+    string *columns = m_indices(values);
+
+    execute(sprintf("insert into %s (%s) values (%s);", table,
+        implode(columnList(columns, "\"%s\""), ","),
+        implode(columnList(columns, "?"), ",")),
+        map(columns, (: $2[$1] :), values));
+
+    return selectValue("select last_insert_rowid();", ({}));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int upsert(string table, mapping keys, mapping values)
+{
+    int ret = findId(table, keys);
+
+    if (ret)
+    {
+        string *columns = m_indices(values);
+        execute(sprintf("update %s set %s where id = ?;", table,
+            implode(columnList(columns, "\"%s\" = ?"), ",")),
+            map(columns, (: $2[$1] :), values) + ({ ret }));
+    }
+    else
+    {
+        ret = insert(table, keys + values);
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int playerIdFromName(string playerName)
+{
+    return selectValue("select id from players where name = ?;",
+        ({ playerName }));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int saveBasicPlayerInformation(string name, string race,
+    int age, int gender, int ghost, int strength, int intelligence,
+    int dexterity, int wisdom, int constitution, int charisma, int invisible,
+    int attributes, int skill, int research, int unassigned, string location,
+    int money)
+{
+    mapping data = ([
+        "race": race,
+        "age": age,
+        "gender": gender,
+        "ghost": ghost,
+        "strength": strength,
+        "intelligence": intelligence,
+        "dexterity": dexterity,
+        "wisdom": wisdom,
+        "constitution": constitution,
+        "charisma": charisma,
+        "invisible": invisible,
+        "attributePoints": attributes,
+        "skillPoints": skill,
+        "researchPoints": research,
+        "unassignedExperience": unassigned,
+        "location": location,
+        "playerMoney": money
+    ]);
+
+    int ret = findId("players", ([ "name": name ]));
+    if (ret)
+    {
+        upsert("players", ([ "name": name ]), data);
+    }
+    else
+    {
+        ret = insert("players", data + ([
+            "name": name,
+            "whenCreated": selectValue("select datetime('now');", ({}))
+        ]));
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void saveBiologicalInformation(int playerId, int intoxicated,
+    int stuffed, int drugged, int soaked, int headache)
+{
+    upsert("biological", ([ "playerid": playerId ]), ([
+        "intoxicated": intoxicated,
+        "stuffed": stuffed,
+        "drugged": drugged,
+        "soaked": soaked,
+        "headache": headache
+    ]));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void saveCombatInformation(int playerId, int hitPoints,
+    int maxHitPoints, int spellPoints, int maxSpellPoints, int staminaPoints,
+    int maxStaminaPoints, int wimpy, int onKillList, int timeToHealHP,
+    int timeToHealSP, int timeToHealST)
+{
+    upsert("playerCombatData", ([ "playerid": playerId ]), ([
+        "hitPoints": hitPoints,
+        "maxHitPoints": maxHitPoints,
+        "spellPoints": spellPoints,
+        "maxSpellPoints": maxSpellPoints,
+        "staminaPoints": staminaPoints,
+        "maxStaminaPoints": maxStaminaPoints,
+        "wimpy": wimpy,
+        "onKillList": onKillList,
+        "timeToHealHP": timeToHealHP,
+        "timeToHealSP": timeToHealSP,
+        "timeToHealST": timeToHealST
+    ]));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void saveMaterialAttribute(int playerId, string type,
+    string value)
+{
+    upsert("materialAttributes", ([ "playerid": playerId, "type": type ]),
+        ([ "value": value ]));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void saveMaterialAttributes(int playerId, string title,
+    string pretitle, string messageIn, string messageOut,
+    string magicalMessageIn, string magicalMessageOut, string messageHome,
+    string messageClone, string shortDescription, string longDescription)
+{
+    mapping attributes = ([
+        "title": title,
+        "pretitle": pretitle,
+        "messageIn": messageIn,
+        "messageOut": messageOut,
+        "magicalMessageIn": magicalMessageIn,
+        "magicalMessageOut": magicalMessageOut,
+        "messageHome": messageHome,
+        "messageClone": messageClone,
+        "shortDescription": shortDescription,
+        "longDescription": longDescription
+    ]);
+
+    foreach(string type in m_indices(attributes))
+    {
+        if (attributes[type] != "")
+        {
+            saveMaterialAttribute(playerId, type, attributes[type]);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void saveGuild(int playerId, string guild, string title,
+    string pretitle, string rank, int level, int experience, int leftGuild,
+    int anathema, int rankAdvancedAt)
+{
+    upsert("guilds", ([ "playerid": playerId, "name": guild ]), ([
+        "title": title,
+        "pretitle": pretitle,
+        "rank": rank,
+        "level": level,
+        "experience": experience,
+        "leftGuild": leftGuild,
+        "anathema": anathema,
+        "rankAdvancedAt": rankAdvancedAt
+    ]));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void saveQuest(int playerId, string quest, string name,
+    string state, string statesCompleted, int isActive, int isCompleted)
+{
+    upsert("quests", ([ "playerid": playerId, "path": quest ]), ([
+        "name": name,
+        "state": state,
+        "statesCompleted": statesCompleted,
+        "isActive": isActive,
+        "isCompleted": isCompleted
+    ]));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void saveResearch(int playerId, string path, int began,
+    int whenCompleted, int timeSpent, int completed, int timeToComplete,
+    int cooldown)
+{
+    upsert("research", ([ "playerid": playerId, "path": path ]), ([
+        "whenResearchBegan": began,
+        "whenResearchComplete": whenCompleted,
+        "timeSpentLearning": timeSpent,
+        "researchComplete": completed,
+        "timeToCompleteLearning": timeToComplete,
+        "cooldown": cooldown
+    ]));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void pruneResearchChoices(int playerId)
+{
+    execute("delete from researchChoiceItems where researchChoiceId in "
+        "(select id from researchChoices where playerid = ?);",
+        ({ playerId }));
+    execute("delete from researchChoices where playerid = ?;",
+        ({ playerId }));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int saveResearchChoice(int playerId, string name)
+{
+    return insert("researchChoices", ([ "playerid": playerId, "name": name ]));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void saveResearchChoiceOption(int choiceId, string selection,
+    string type, string name, string description, string key)
+{
+    insert("researchChoiceItems", ([
+        "researchChoiceId": choiceId,
+        "selectionNumber": selection,
+        "type": type,
+        "name": name,
+        "description": description,
+        "key": key
+    ]));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void saveOpenResearchTrees(int playerId, string path)
+{
+    mapping data = ([ "playerid": playerId, "researchTree": path ]);
+    if (!findId("openResearchTrees", data))
+    {
+        insert("openResearchTrees", data);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void saveSkills(int playerId, string name, int value)
+{
+    upsert("skills", ([ "playerid": playerId, "name": name ]),
+        ([ "value": value ]));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void saveTraits(int playerId, string path, string name,
+    int added, int endTime, string expireMessage, string triggeringResearch)
+{
+    mapping keys = ([ "playerid": playerId, "path": path ]);
+    int traitId = findId("traits", keys);
+
+    if (traitId)
+    {
+        upsert("traits", keys, ([ "name": name, "added": added ]));
+
+        if (endTime)
+        {
+            execute("update timedtraits set endTime = ?, expireMessage = ?, "
+                "triggeringResearch = ? where traitid = ?;",
+                ({ endTime, expireMessage, triggeringResearch, traitId }));
+        }
+    }
+    else
+    {
+        traitId = insert("traits", keys + ([ "name": name, "added": added ]));
+
+        if (endTime)
+        {
+            insert("timedtraits", ([
+                "traitid": traitId,
+                "endTime": endTime,
+                "expireMessage": expireMessage,
+                "triggeringResearch": triggeringResearch
+            ]));
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void saveTemporaryTraits(int playerId, string traits)
+{
+    upsert("temporaryTraits", ([ "playerid": playerId ]),
+        ([ "traitList": traits ]));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void pruneInventory(int playerId)
+{
+    execute("delete from inventory where playerid = ?;", ({ playerId }));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void saveInventoryItem(int playerId, string fileName,
+    string data, int isEquipped)
+{
+    execute("insert into inventory (playerid, fileName, data, isEquipped) "
+        "values (?, ?, ?, ?);", ({ playerId, fileName, data, isEquipped }));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void saveFaction(int playerId, string path,
+    string disposition, int reputation, int lastInteraction,
+    int lastReputation, int numberOfInteractions, int dispositionTime,
+    int isMember)
+{
+    upsert("factions", ([ "playerid": playerId, "path": path ]), ([
+        "disposition": disposition,
+        "reputation": reputation,
+        "lastInteraction": lastInteraction,
+        "lastReputation": lastReputation,
+        "numberOfInteractions": numberOfInteractions,
+        "dispositionTime": dispositionTime,
+        "isMember": isMember
+    ]));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void saveCombatStatistics(string playerName, string foeKey,
+    string foeName, int level, int timesKilled)
+{
+    int playerId = playerIdFromName(playerName);
+
+    if (playerId)
+    {
+        mapping keys = ([ "playerid": playerId, "foeKey": foeKey ]);
+        int statId = findId("combatStatistics", keys);
+
+        if (statId)
+        {
+            execute("update combatStatistics set timesKilled = "
+                "timesKilled + ? where id = ?;", ({ timesKilled, statId }));
+        }
+        else
+        {
+            insert("combatStatistics", keys + ([
+                "name": foeName,
+                "level": level,
+                "timesKilled": timesKilled
+            ]));
+        }
+
+        execute("update combatStatistics set isNemesis = 0, isBestKill = 0 "
+            "where playerid = ?;", ({ playerId }));
+
+        execute("update combatStatistics set isNemesis = 1 where id = "
+            "(select id from combatStatistics where playerid = ? "
+            "order by timesKilled desc, level desc limit 1);",
+            ({ playerId }));
+
+        execute("update combatStatistics set isBestKill = 1 where id = "
+            "(select id from combatStatistics where playerid = ? "
+            "order by level desc, timesKilled desc limit 1);",
+            ({ playerId }));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void saveCombatStatisticsForRace(string playerName,
+    string race, int timesKilled)
+{
+    int playerId = playerIdFromName(playerName);
+
+    if (playerId)
+    {
+        mapping keys = ([ "playerid": playerId, "race": race ]);
+        int statId = findId("combatStatisticsForRace", keys);
+
+        if (statId)
+        {
+            execute("update combatStatisticsForRace set timesKilled = "
+                "timesKilled + ? where id = ?;", ({ timesKilled, statId }));
+        }
+        else
+        {
+            insert("combatStatisticsForRace",
+                keys + ([ "timesKilled": timesKilled ]));
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void saveWizardLevel(int playerId, string level)
+{
+    int levelId = selectValue("select id from wizardTypes where type = ?;",
+        ({ level }));
+
+    if (levelId)
+    {
+        upsert("wizards", ([ "playerId": playerId ]),
+            ([ "typeId": levelId ]));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void saveOpinionOfCharacter(string playerName,
+    string targetKey, int opinion, int lastInteraction)
+{
+    int playerId = playerIdFromName(playerName);
+
+    if (playerId)
+    {
+        upsert("opinions", ([ "playerId": playerId, "targetKey": targetKey ]),
+            ([ "opinion": opinion, "lastInteraction": lastInteraction ]));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void saveCharacterState(string playerName, string targetKey,
+    string state)
+{
+    int playerId = playerIdFromName(playerName);
+
+    if (playerId)
+    {
+        upsert("characterStates",
+            ([ "playerId": playerId, "targetKey": targetKey ]),
+            ([ "state": state ]));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask closure procedureClosure(string name)
+{
+    if (!procedures)
+    {
+        procedures = ([
+            "saveBasicPlayerInformation": #'saveBasicPlayerInformation,
+            "saveBiologicalInformation": #'saveBiologicalInformation,
+            "saveCombatInformation": #'saveCombatInformation,
+            "saveMaterialAttribute": #'saveMaterialAttribute,
+            "saveMaterialAttributes": #'saveMaterialAttributes,
+            "saveGuild": #'saveGuild,
+            "saveQuest": #'saveQuest,
+            "saveResearch": #'saveResearch,
+            "pruneResearchChoices": #'pruneResearchChoices,
+            "saveResearchChoice": #'saveResearchChoice,
+            "saveResearchChoiceOption": #'saveResearchChoiceOption,
+            "saveOpenResearchTrees": #'saveOpenResearchTrees,
+            "saveSkills": #'saveSkills,
+            "saveTraits": #'saveTraits,
+            "saveTemporaryTraits": #'saveTemporaryTraits,
+            "pruneInventory": #'pruneInventory,
+            "saveInventoryItem": #'saveInventoryItem,
+            "saveFaction": #'saveFaction,
+            "saveCombatStatistics": #'saveCombatStatistics,
+            "saveCombatStatisticsForRace": #'saveCombatStatisticsForRace,
+            "saveWizardLevel": #'saveWizardLevel,
+            "saveOpinionOfCharacter": #'saveOpinionOfCharacter,
+            "saveCharacterState": #'saveCharacterState
+        ]);
+    }
+
+    if (!member(procedures, name))
+    {
+        raise_error(sprintf("sqliteBackend: Unknown procedure '%s'.\n",
+            name));
+    }
+    return procedures[name];
+}
+
+/////////////////////////////////////////////////////////////////////////////
+protected void abandonSessions()
+{
+    // Nothing done in a failed session is kept - the next session starts
+    // a new transaction.
+    if (openSessions)
+    {
+        catch (sl_exec("rollback transaction;"); nolog);
+    }
+    openSessions = 0;
+    pendingRows = ({});
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask mixed runGuarded(closure work, mixed *arguments)
+{
+    mixed ret;
+    string error = catch (ret = apply(work, arguments); nolog);
+
+    if (error)
+    {
+        abandonSessions();
+        raise_error((error[0] == '*') ? error[1..] : error);
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask mixed runProcedure(string name, mixed *arguments)
+{
+    return apply(procedureClosure(name), arguments);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask int connect()
+{
+    verifyAccess();
+
+    if (!isOpen)
+    {
+        sl_open(DatabaseFile);
+        sl_exec("pragma foreign_keys = on;");
+        isOpen = 1;
+    }
+
+    // A session still open from an earlier evaluation was ended by an error
+    // before it could disconnect.
+    if (openSessions &&
+        (sessionEvaluation != debug_info(DINFO_EVAL_NUMBER)))
+    {
+        abandonSessions();
+    }
+
+    // Everything done between connect and disconnect is committed at once
+    // rather than paying for a journal sync on every statement.
+    if (!openSessions)
+    {
+        sl_exec("begin transaction;");
+        sessionEvaluation = debug_info(DINFO_EVAL_NUMBER);
+    }
+    openSessions++;
+    return Handle;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void disconnect(int handle)
+{
+    verifyAccess();
+    pendingRows = ({});
+
+    if (openSessions > 0)
+    {
+        openSessions--;
+        if (!openSessions)
+        {
+            sl_exec("commit transaction;");
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void executeQuery(int handle, string query)
+{
+    verifyAccess();
+    recordRequest();
+    pendingRows = runGuarded(#'execute, ({ query, ({}) }));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask mixed fetchResult(int handle)
+{
+    verifyAccess();
+
+    mixed ret = 0;
+    if (sizeof(pendingRows))
+    {
+        ret = pendingRows[0];
+        pendingRows = pendingRows[1..];
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void callProcedure(int handle, string procedure,
+    mixed *arguments)
+{
+    verifyAccess();
+    recordRequest();
+    runGuarded(#'runProcedure, ({ procedure, arguments }));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask mixed callFunction(int handle, string functionName,
+    mixed *arguments)
+{
+    verifyAccess();
+    recordRequest();
+    return ({ runGuarded(#'runProcedure, ({ functionName, arguments })) });
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public string sanitizeString(string value)
+{
+    return regreplace(value || "", "'", "''", 1);
+}
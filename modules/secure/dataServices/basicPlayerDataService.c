@@ -11,8 +11,8 @@ protected nomask mapping getBasicPlayerData(string name, int dbHandle)
 
     string query = sprintf("select * from basicPlayerData "
         "where name = '%s'", sanitizeString(name));
-    db_exec(dbHandle, query);
-    mixed result = db_fetch(dbHandle);
+    executeQuery(dbHandle, query);
+    mixed result = fetchResult(dbHandle);
 
     // Yuck... they seriously didn't implement DB support better?
     // Task 59 was created in the Realms Driver project to improve this.
@@ -62,10 +62,9 @@ protected nomask mapping getBasicPlayerData(string name, int dbHandle)
 /////////////////////////////////////////////////////////////////////////////
 protected nomask int saveBasicPlayerData(int dbHandle, mapping playerData)
 {
-    string query = sprintf("select saveBasicPlayerInformation("
-        "'%s','%s',%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,'%s',%d);",
-        sanitizeString(playerData["name"]),
-        sanitizeString(playerData["race"]),
+    mixed result = callFunction(dbHandle, "saveBasicPlayerInformation", ({
+        convertString(playerData["name"]),
+        convertString(playerData["race"]),
         playerData["age"],
         playerData["gender"],
         playerData["ghost"],
@@ -80,11 +79,8 @@ protected nomask int saveBasicPlayerData(int dbHandle, mapping playerData)
         playerData["availableSkillPoints"],
         playerData["availableResearchPoints"],
         playerData["unassignedExperience"],
-        playerData["location"],
-        playerData["money"]);
-
-    db_exec(dbHandle, query);
-    mixed result = db_fetch(dbHandle);
+        convertString(playerData["location"]),
+        playerData["money"] }));
 
     int ret = 0;
     if (sizeof(result))
@@ -97,24 +93,19 @@ protected nomask int saveBasicPlayerData(int dbHandle, mapping playerData)
 /////////////////////////////////////////////////////////////////////////////
 protected nomask void saveBiologicalData(int dbHandle, int playerId, mapping playerData)
 {
-    string query = sprintf("call saveBiologicalInformation("
-        "%d,%d,%d,%d,%d,%d);",
+    callProcedure(dbHandle, "saveBiologicalInformation", ({
         playerId,
         playerData["intoxicated"],
         playerData["stuffed"],
         playerData["drugged"],
         playerData["soaked"],
-        playerData["headache"]);
-
-    db_exec(dbHandle, query);
-    mixed result = db_fetch(dbHandle);
+        playerData["headache"] }));
 }
 
 /////////////////////////////////////////////////////////////////////////////
 protected nomask void saveCombatData(int dbHandle, int playerId, mapping playerData)
 {
-    string query = sprintf("call saveCombatInformation("
-        "%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d);",
+    callProcedure(dbHandle, "saveCombatInformation", ({
         playerId,
         playerData["hitPoints"],
         playerData["maxHitPoints"],
@@ -126,8 +117,5 @@ protected nomask void saveCombatData(int dbHandle, int playerId, mapping playerD
         playerData["onKillList"],
         playerData["timeToHealHP"],
         playerData["timeToHealSP"],
-        playerData["timeToHealST"]);
-
-    db_exec(dbHandle, query);
-    mixed result = db_fetch(dbHandle);
+        playerData["timeToHealST"] }));
 }
@@ -5,35 +5,125 @@
 virtual inherit "/lib/modules/secure/dataServices/dataService.c";
 
 /////////////////////////////////////////////////////////////////////////////
-public nomask void saveCombatStatistics(string playerName,
-                                        string foeKey,
-                                        string foeName,
-                                        int foeLevel)
+protected nomask mapping getCombatStatistics(int playerId, int dbHandle)
 {
-    string query = sprintf("call saveCombatStatistics('%s','%s','%s',%d);",
-        sanitizeString(playerName), 
-        sanitizeString(foeKey), 
-        sanitizeString(foeName), 
-        foeLevel);
+    mapping ret = ([
+        "combatStatistics": ([
+            "kills": ([]),
+            "races": ([]),
+            "nemesis": 0,
+            "best kill": 0
+        ])
+    ]);
+
+    string query = sprintf("select name, level, foeKey, timesKilled, "
+        "isNemesis, isBestKill from combatStatistics "
+        "where playerid = '%d'", playerId);
+    executeQuery(dbHandle, query);
+
+    mixed result;
+    do
+    {
+        result = fetchResult(dbHandle);
+        if (result)
+        {
+            ret["combatStatistics"]["kills"][result[2]] = ([
+                "name": convertString(result[0]),
+                "level": to_int(result[1]),
+                "key": result[2],
+                "times killed": to_int(result[3])
+            ]);
+
+            if (to_int(result[4]))
+            {
+                ret["combatStatistics"]["nemesis"] = result[2];
+            }
+            if (to_int(result[5]))
+            {
+                ret["combatStatistics"]["best kill"] = result[2];
+            }
+        }
+    } while (result);
+
+    query = sprintf("select race, timesKilled from combatStatisticsForRace "
+        "where playerid = '%d'", playerId);
+    executeQuery(dbHandle, query);
+
+    do
+    {
+        result = fetchResult(dbHandle);
+        if (result)
+        {
+            ret["combatStatistics"]["races"][result[0]] = to_int(result[1]);
+        }
+    } while (result);
+
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void executeSaveCombatStatistics(int dbHandle,
+    string playerName, string foeKey, string foeName, int foeLevel,
+    int timesKilled)
+{
+    callProcedure(dbHandle, "saveCombatStatistics", ({ playerName, foeKey,
+        foeName, foeLevel, timesKilled }));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void executeSaveCombatStatisticsForRace(int dbHandle,
+    string playerName, string race, int timesKilled)
+{
+    callProcedure(dbHandle, "saveCombatStatisticsForRace", ({ playerName,
+        race, timesKilled }));
+}
 
+/////////////////////////////////////////////////////////////////////////////
+public nomask varargs void saveCombatStatistics(string playerName,
+                                                string foeKey,
+                                                string foeName,
+                                                int foeLevel,
+                                                int timesKilled)
+{
     int dbHandle = connect();
-    db_exec(dbHandle, query);
-    mixed result = db_fetch(dbHandle);
+    executeSaveCombatStatistics(dbHandle, playerName, foeKey, foeName, 
+        foeLevel, timesKilled ? timesKilled : 1);
     disconnect(dbHandle);
 }
 
 /////////////////////////////////////////////////////////////////////////////
-public nomask void saveCombatStatisticsForRace(string playerName, string race)
+public nomask varargs void saveCombatStatisticsForRace(string playerName, 
+    string race, int timesKilled)
 {
-    string query = sprintf("call saveCombatStatisticsForRace('%s','%s');",
-        sanitizeString(playerName), sanitizeString(race));
-
     int dbHandle = connect();
-    db_exec(dbHandle, query);
-    mixed result = db_fetch(dbHandle);
+    executeSaveCombatStatisticsForRace(dbHandle, playerName, race,
+        timesKilled ? timesKilled : 1);
     disconnect(dbHandle);
 }
 
+/////////////////////////////////////////////////////////////////////////////
+public nomask void saveBufferedCombatStatistics(string playerName,
+    mapping kills, mapping races)
+{
+    if (sizeof(kills) || sizeof(races))
+    {
+        int dbHandle = connect();
+        foreach(string foeKey in m_indices(kills))
+        {
+            executeSaveCombatStatistics(dbHandle, playerName, foeKey,
+                kills[foeKey]["name"], kills[foeKey]["level"],
+                kills[foeKey]["times killed"]);
+        }
+
+        foreach(string race in m_indices(races))
+        {
+            executeSaveCombatStatisticsForRace(dbHandle, playerName, race,
+                races[race]);
+        }
+        disconnect(dbHandle);
+    }
+}
+
 /////////////////////////////////////////////////////////////////////////////
 public nomask int bestKillMeetsLevel(string name, int level)
 {
@@ -45,8 +135,8 @@ public nomask int bestKillMeetsLevel(string name, int level)
         sanitizeString(name), level);
 
     int dbHandle = connect();
-    db_exec(dbHandle, query);
-    mixed result = db_fetch(dbHandle);
+    executeQuery(dbHandle, query);
+    mixed result = fetchResult(dbHandle);
     disconnect(dbHandle);
 
     if (result)
@@ -67,8 +157,8 @@ public nomask int racialKillsMeetCount(string name, string race, int timesKilled
         sanitizeString(name), sanitizeString(race), timesKilled);
 
     int dbHandle = connect();
-    db_exec(dbHandle, query);
-    mixed result = db_fetch(dbHandle);
+    executeQuery(dbHandle, query);
+    mixed result = fetchResult(dbHandle);
     disconnect(dbHandle);
 
     if (result)
@@ -90,8 +180,8 @@ public nomask mapping getBestKill(string player)
         sanitizeString(player));
 
     int dbHandle = connect();
-    db_exec(dbHandle, query);
-    mixed result = db_fetch(dbHandle);
+    executeQuery(dbHandle, query);
+    mixed result = fetchResult(dbHandle);
     disconnect(dbHandle);
 
     if (result)
@@ -118,8 +208,8 @@ public nomask mapping getNemesis(string player)
         sanitizeString(player));
 
     int dbHandle = connect();
-    db_exec(dbHandle, query);
-    mixed result = db_fetch(dbHandle);
+    executeQuery(dbHandle, query);
+    mixed result = fetchResult(dbHandle);
     disconnect(dbHandle);
 
     if (result)
@@ -17,8 +17,8 @@ public nomask int getOpinionOfCharacter(string playerName,
         sanitizeString(targetKey));
 
     int dbHandle = connect();
-    db_exec(dbHandle, query);
-    mixed result = db_fetch(dbHandle);
+    executeQuery(dbHandle, query);
+    mixed result = fetchResult(dbHandle);
     disconnect(dbHandle);
 
     if (sizeof(result))
@@ -32,12 +32,8 @@ public nomask int getOpinionOfCharacter(string playerName,
 public nomask void setOpinionOfCharacter(string playerName,
     string targetKey, int value)
 {
-    string query = sprintf("call saveOpinionOfCharacter('%s','%s', %d, %d);",
-        sanitizeString(playerName), sanitizeString(targetKey),
-        value, time());
-
     int dbHandle = connect();
-    db_exec(dbHandle, query);
-    mixed result = db_fetch(dbHandle);
+    callProcedure(dbHandle, "saveOpinionOfCharacter", ({ playerName,
+        targetKey, value, time() }));
     disconnect(dbHandle);
 }
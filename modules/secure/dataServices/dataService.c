@@ -2,6 +2,8 @@
 // Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
 //                      the accompanying LICENSE file for details.
 //*****************************************************************************
+private nosave string BackendRegistry =
+    "/lib/modules/secure/dataServices/backends/backendRegistry.c";
 
 /////////////////////////////////////////////////////////////////////////////
 protected nomask string convertString(string input)
@@ -14,38 +16,56 @@ protected nomask string convertString(string input)
     return ret;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+protected nomask object databaseBackend()
+{
+    return load_object(BackendRegistry)->activeBackend();
+}
+
 /////////////////////////////////////////////////////////////////////////////
 protected nomask int connect()
 {
-    int ret = 0;
+    return databaseBackend()->connect();
+}
 
-    if (!sizeof(db_handles()))
-    {
-        ret = db_connect(RealmsDatabase());
-    }
-    else
-    {
-        ret = db_handles()[0];
-    }
-    if (db_error(ret))
-    {
-        raise_error(db_error(ret));
-    }
+/////////////////////////////////////////////////////////////////////////////
+protected nomask void disconnect(int handle)
+{
+    databaseBackend()->disconnect(handle);
+}
 
-    if (ret)
-    {
-        db_exec(ret, "use " + RealmsDatabase() + ";");
-    }
+/////////////////////////////////////////////////////////////////////////////
+protected nomask void executeQuery(int handle, string query)
+{
+    databaseBackend()->executeQuery(handle, query);
+}
 
-    while (db_fetch(ret));
-    return ret;
+/////////////////////////////////////////////////////////////////////////////
+protected nomask mixed fetchResult(int handle)
+{
+    return databaseBackend()->fetchResult(handle);
 }
 
 /////////////////////////////////////////////////////////////////////////////
-protected nomask void disconnect(int handle)
+protected nomask varargs void callProcedure(int handle, string procedure,
+    mixed *arguments)
+{
+    databaseBackend()->callProcedure(handle, procedure, arguments || ({}));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+protected nomask varargs mixed callFunction(int handle,
+    string functionName, mixed *arguments)
+{
+    return databaseBackend()->callFunction(handle, functionName,
+        arguments || ({}));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+protected nomask varargs void runOperation(closure operation,
+    mixed *arguments, closure callback)
 {
-    while(db_fetch(handle));
-    db_close(handle);
+    databaseBackend()->runOperation(operation, arguments || ({}), callback);
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -55,6 +75,6 @@ protected nomask string sanitizeString(string value)
     {
         value = "";
     }
-    
-    return db_conv_string(value);
+
+    return databaseBackend()->sanitizeString(value);
 }
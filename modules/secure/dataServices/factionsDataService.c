@@ -15,13 +15,13 @@ protected nomask mapping getFactions(int playerId, int dbHandle)
 
     string query = sprintf("select * from factions "
         "where playerid = '%d'", playerId);
-    db_exec(dbHandle, query);
+    executeQuery(dbHandle, query);
 
     mixed result;
 
     do
     {
-        result = db_fetch(dbHandle);
+        result = fetchResult(dbHandle);
         if (result)
         {
             ret["factions"][result[2]] = ([
@@ -51,20 +51,16 @@ protected nomask void saveFactions(int dbHandle, int playerId, mapping playerDat
         string *factions = m_indices(playerData["factions"]);
         foreach(string faction in factions)
         {
-            string query = sprintf("call saveFaction("
-                "%d,'%s','%s',%d,%d,%d,%d,%d,%d);",
+            callProcedure(dbHandle, "saveFaction", ({
                 playerId,
-                sanitizeString(faction),
-                sanitizeString(playerData["factions"][faction]["disposition"]),
+                faction,
+                convertString(playerData["factions"][faction]["disposition"]),
                 playerData["factions"][faction]["reputation"],
                 playerData["factions"][faction]["last interaction"],
                 playerData["factions"][faction]["last interaction reputation"],
                 playerData["factions"][faction]["number of interactions"],
                 playerData["factions"][faction]["disposition time"],
-                (member(playerData["memberOfFactions"], faction) > -1)
-            );
-            db_exec(dbHandle, query);
-            mixed result = db_fetch(dbHandle);
+                (member(playerData["memberOfFactions"], faction) > -1) }));
         }
     }
 }
@@ -11,13 +11,13 @@ protected nomask mapping getGuildData(int playerId, int dbHandle)
 
     string query = sprintf("select * from guilds "
         "where playerid = '%d'", playerId);
-    db_exec(dbHandle, query);
+    executeQuery(dbHandle, query);
 
     mixed result;
     
     do
     {
-        result = db_fetch(dbHandle);
+        result = fetchResult(dbHandle);
         if (result)
         {
             ret["guilds"][result[2]] = ([
@@ -45,20 +45,17 @@ protected nomask void saveGuildData(int dbHandle, int playerId, mapping playerDa
         string *guilds = m_indices(playerData["guilds"]);
         foreach(string guild in guilds)
         {
-            string query = sprintf("call saveGuild("
-                "%d,'%s','%s','%s','%s',%d,%d,%d,%d,%d);",
+            callProcedure(dbHandle, "saveGuild", ({
                 playerId,
-                sanitizeString(guild),
-                sanitizeString(convertString(playerData["guilds"][guild]["title"])),
-                sanitizeString(convertString(playerData["guilds"][guild]["pretitle"])),
-                sanitizeString(convertString(playerData["guilds"][guild]["rank"])),
+                guild,
+                convertString(playerData["guilds"][guild]["title"]),
+                convertString(playerData["guilds"][guild]["pretitle"]),
+                convertString(playerData["guilds"][guild]["rank"]),
                 playerData["guilds"][guild]["level"],
                 playerData["guilds"][guild]["experience"],
                 playerData["guilds"][guild]["left guild"],
                 playerData["guilds"][guild]["anathema"],
-                playerData["guilds"][guild]["rank advanced at"]);
-            db_exec(dbHandle, query);
-            mixed result = db_fetch(dbHandle);
+                playerData["guilds"][guild]["rank advanced at"] }));
         }
     }
 }
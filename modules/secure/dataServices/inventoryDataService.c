@@ -11,13 +11,13 @@ protected nomask mapping getInventory(int playerId, int dbHandle)
 
     string query = sprintf("select * from inventory "
         "where playerid = '%d'", playerId);
-    db_exec(dbHandle, query);
+    executeQuery(dbHandle, query);
 
     mixed result;
 
     do
     {
-        result = db_fetch(dbHandle);
+        result = fetchResult(dbHandle);
         if (result)
         {
             ret["inventory"][result[1]] = ([
@@ -33,9 +33,7 @@ protected nomask mapping getInventory(int playerId, int dbHandle)
 /////////////////////////////////////////////////////////////////////////////
 protected nomask void saveInventory(int dbHandle, int playerId, mapping playerData)
 {
-    string query = sprintf("call pruneInventory(%d);", playerId);
-    db_exec(dbHandle, query);
-    mixed result = db_fetch(dbHandle);
+    callProcedure(dbHandle, "pruneInventory", ({ playerId }));
 
     if (member(playerData, "inventory") &&
         sizeof(playerData["inventory"]))
@@ -43,13 +41,11 @@ protected nomask void saveInventory(int dbHandle, int playerId, mapping playerDa
         string *inventoryItems = m_indices(playerData["inventory"]);
         foreach(string item in inventoryItems)
         {
-            query = sprintf("call saveInventoryItem(%d,'%s','%s',%d);",
+            callProcedure(dbHandle, "saveInventoryItem", ({
                 playerId,
-                sanitizeString(item),
-                sanitizeString(playerData["inventory"][item]["data"]),
-                playerData["inventory"][item]["isEquipped"]);
-            db_exec(dbHandle, query);
-            result = db_fetch(dbHandle);
+                item,
+                convertString(playerData["inventory"][item]["data"]),
+                playerData["inventory"][item]["isEquipped"] }));
         }
     }
 }
@@ -11,13 +11,13 @@ protected nomask mapping getMaterialAttributes(int playerId, int dbHandle)
 
     string query = sprintf("select * from materialAttributes "
         "where playerid = '%d'", playerId);
-    db_exec(dbHandle, query);
+    executeQuery(dbHandle, query);
 
     mixed result;
 
     do
     {
-        result = db_fetch(dbHandle);
+        result = fetchResult(dbHandle);
         if (result)
         {
             ret[result[2]] = result[3];
@@ -30,20 +30,16 @@ protected nomask mapping getMaterialAttributes(int playerId, int dbHandle)
 /////////////////////////////////////////////////////////////////////////////
 protected nomask void saveMaterialAttributes(int dbHandle, int playerId, mapping playerData)
 {
-    string query = sprintf("call saveMaterialAttributes("
-        "%d,'%s','%s','%s','%s','%s','%s','%s','%s','%s','%s');",
+    callProcedure(dbHandle, "saveMaterialAttributes", ({
         playerId,
-        sanitizeString(playerData["title"] || ""),
-        sanitizeString(playerData["pretitle"] || ""),
-        sanitizeString(playerData["messageIn"] || ""),
-        sanitizeString(playerData["messageOut"] || ""),
-        sanitizeString(playerData["magicalMessageIn"] || ""),
-        sanitizeString(playerData["magicalMessageOut"] || ""),
-        sanitizeString(playerData["messageHome"] || ""),
-        sanitizeString(playerData["messageClone"] || ""),
-        sanitizeString(playerData["shortDescription"] || ""),
-        sanitizeString(playerData["longDescription"] || ""));
-
-    db_exec(dbHandle, query);
-    mixed result = db_fetch(dbHandle);
+        playerData["title"] || "",
+        playerData["pretitle"] || "",
+        playerData["messageIn"] || "",
+        playerData["messageOut"] || "",
+        playerData["magicalMessageIn"] || "",
+        playerData["magicalMessageOut"] || "",
+        playerData["messageHome"] || "",
+        playerData["messageClone"] || "",
+        playerData["shortDescription"] || "",
+        playerData["longDescription"] || "" }));
 }
@@ -11,13 +11,13 @@ protected nomask mapping getQuestData(int playerId, int dbHandle)
 
     string query = sprintf("select * from quests "
         "where playerid = '%d'", playerId);
-    db_exec(dbHandle, query);
+    executeQuery(dbHandle, query);
 
     mixed result;
 
     do
     {
-        result = db_fetch(dbHandle);
+        result = fetchResult(dbHandle);
         if (result)
         {
             ret["quests"][result[2]] = ([
@@ -42,17 +42,14 @@ protected nomask void saveQuestData(int dbHandle, int playerId, mapping playerDa
         string *quests = m_indices(playerData["quests"]);
         foreach(string quest in quests)
         {
-            string query = sprintf("call saveQuest("
-                "%d,'%s','%s','%s','%s',%d,%d);",
+            callProcedure(dbHandle, "saveQuest", ({
                 playerId,
-                sanitizeString(quest),
-                sanitizeString(playerData["quests"][quest]["name"]),
-                sanitizeString(playerData["quests"][quest]["state"]),
-                sanitizeString(playerData["quests"][quest]["states completed"]),
+                quest,
+                convertString(playerData["quests"][quest]["name"]),
+                convertString(playerData["quests"][quest]["state"]),
+                convertString(playerData["quests"][quest]["states completed"]),
                 playerData["quests"][quest]["is active"],
-                playerData["quests"][quest]["is completed"]);
-            db_exec(dbHandle, query);
-            mixed result = db_fetch(dbHandle);
+                playerData["quests"][quest]["is completed"] }));
         }
     }
 }
@@ -11,13 +11,13 @@ protected nomask mapping getResearch(int playerId, int dbHandle)
 
     string query = sprintf("select * from research "
         "where playerid = '%d'", playerId);
-    db_exec(dbHandle, query);
+    executeQuery(dbHandle, query);
 
     mixed result;
 
     do
     {
-        result = db_fetch(dbHandle);
+        result = fetchResult(dbHandle);
         if (result)
         {
             ret["research"][result[2]] = ([
@@ -41,13 +41,13 @@ protected nomask mapping getResearchChoices(int playerId, int dbHandle)
 
     string query = sprintf("select * from researchChoicesView "
         "where playerid = '%d'", playerId);
-    db_exec(dbHandle, query);
+    executeQuery(dbHandle, query);
 
     mixed result;
 
     do
     {
-        result = db_fetch(dbHandle);
+        result = fetchResult(dbHandle);
         if (result)
         {
             if(!member(ret["researchChoices"], result[1]))
@@ -75,13 +75,13 @@ protected nomask mapping getOpenResearchTrees(int playerId, int dbHandle)
 
     string query = sprintf("select researchTree from openResearchTrees "
         "where playerid = '%d'", playerId);
-    db_exec(dbHandle, query);
+    executeQuery(dbHandle, query);
 
     mixed result;
 
     do
     {
-        result = db_fetch(dbHandle);
+        result = fetchResult(dbHandle);
         if (result)
         {
             ret["openResearchTrees"] += ({ convertString(result[0]) });
@@ -101,18 +101,15 @@ protected nomask void saveResearch(int dbHandle, int playerId, mapping playerDat
         string *researchItems = m_indices(playerData["research"]);
         foreach(string research in researchItems)
         {
-            string query = sprintf("call saveResearch("
-                "%d,'%s',%d,%d,%d,%d,%d,%d);",
+            callProcedure(dbHandle, "saveResearch", ({
                 playerId,
-                sanitizeString(research),
+                research,
                 playerData["research"][research]["when research began"],
                 playerData["research"][research]["when research complete"],
                 playerData["research"][research]["time spent learning"],
                 playerData["research"][research]["research complete"],
                 playerData["research"][research]["time to complete learning"],
-                playerData["research"][research]["cooldown"]);
-            db_exec(dbHandle, query);
-            mixed result = db_fetch(dbHandle);
+                playerData["research"][research]["cooldown"] }));
         }
     }
 }
@@ -120,9 +117,7 @@ protected nomask void saveResearch(int dbHandle, int playerId, mapping playerDat
 /////////////////////////////////////////////////////////////////////////////
 protected nomask void saveResearchChoices(int dbHandle, int playerId, mapping playerData)
 {
-    string query = sprintf("call pruneResearchChoices(%d);", playerId);
-    db_exec(dbHandle, query);
-    mixed result = db_fetch(dbHandle);
+    callProcedure(dbHandle, "pruneResearchChoices", ({ playerId }));
 
     if (member(playerData, "researchChoices") &&
         sizeof(playerData["researchChoices"]))
@@ -130,11 +125,8 @@ protected nomask void saveResearchChoices(int dbHandle, int playerId, mapping pl
         string *choices = m_indices(playerData["researchChoices"]);
         foreach(string choice in choices)
         {
-            query = sprintf("select saveResearchChoice(%d,'%s');",
-                playerId, sanitizeString(choice));
-
-            db_exec(dbHandle, query);
-            result = db_fetch(dbHandle);
+            mixed result = callFunction(dbHandle, "saveResearchChoice", 
+                ({ playerId, choice }));
 
             if (sizeof(result))
             {
@@ -143,16 +135,13 @@ protected nomask void saveResearchChoices(int dbHandle, int playerId, mapping pl
                 foreach(string option in options)
                 {
                     mapping optionMap = playerData["researchChoices"][choice][option];
-                    query = sprintf("call saveResearchChoiceOption("
-                        "%d,'%s','%s','%s','%s','%s');", id,
-                        sanitizeString(option),
-                        sanitizeString(optionMap["type"]),
-                        sanitizeString(optionMap["name"]),
-                        sanitizeString(optionMap["description"]),
-                        sanitizeString(optionMap["key"]));
-
-                    db_exec(dbHandle, query);
-                    result = db_fetch(dbHandle);
+                    callProcedure(dbHandle, "saveResearchChoiceOption", ({
+                        id,
+                        option,
+                        convertString(optionMap["type"]),
+                        convertString(optionMap["name"]),
+                        convertString(optionMap["description"]),
+                        convertString(optionMap["key"]) }));
                 }
             }
         }
@@ -167,10 +156,8 @@ protected nomask void saveOpenResearchTrees(int dbHandle, int playerId, mapping
     {
         foreach(string tree in playerData["openResearchTrees"])
         {
-            string query = sprintf("call saveOpenResearchTrees(%d,'%s');",
-                playerId, sanitizeString(tree));
-            db_exec(dbHandle, query);
-            mixed result = db_fetch(dbHandle);
+            callProcedure(dbHandle, "saveOpenResearchTrees", 
+                ({ playerId, tree }));
         }
     }
 }
@@ -11,13 +11,13 @@ protected nomask mapping getSkills(int playerId, int dbHandle)
 
     string query = sprintf("select * from skills "
         "where playerid = '%d'", playerId);
-    db_exec(dbHandle, query);
+    executeQuery(dbHandle, query);
 
     mixed result;
 
     do
     {
-        result = db_fetch(dbHandle);
+        result = fetchResult(dbHandle);
         if (result)
         {
             ret["skills"][result[2]] = to_int(result[3]);
@@ -36,12 +36,10 @@ protected nomask void saveSkills(int dbHandle, int playerId, mapping playerData)
         string *skills = m_indices(playerData["skills"]);
         foreach(string skill in skills)
         {
-            string query = sprintf("call saveSkills(%d,'%s',%d);",
+            callProcedure(dbHandle, "saveSkills", ({
                 playerId,
-                sanitizeString(skill),
-                playerData["skills"][skill]);
-            db_exec(dbHandle, query);
-            mixed result = db_fetch(dbHandle);
+                skill,
+                playerData["skills"][skill] }));
         }
     }
 }
@@ -16,8 +16,8 @@ public nomask string getCharacterState(string playerName, string targetKey)
         sanitizeString(targetKey));
 
     int dbHandle = connect();
-    db_exec(dbHandle, query);
-    mixed result = db_fetch(dbHandle);
+    executeQuery(dbHandle, query);
+    mixed result = fetchResult(dbHandle);
     disconnect(dbHandle);
 
     if (sizeof(result))
@@ -31,13 +31,8 @@ public nomask string getCharacterState(string playerName, string targetKey)
 public nomask void setCharacterState(string playerName,
     string targetKey, string value)
 {
-    string query = sprintf("call saveCharacterState('%s','%s','%s');",
-        sanitizeString(lower_case(playerName)), 
-        sanitizeString(targetKey), 
-        sanitizeString(value));
-
     int dbHandle = connect();
-    db_exec(dbHandle, query);
-    mixed result = db_fetch(dbHandle);
+    callProcedure(dbHandle, "saveCharacterState", ({ 
+        lower_case(playerName), targetKey, convertString(value) }));
     disconnect(dbHandle);
 }
@@ -11,13 +11,13 @@ protected nomask mapping getTraits(int playerId, int dbHandle)
 
     string query = sprintf("select * from traitsView "
         "where playerid = '%d'", playerId);
-    db_exec(dbHandle, query);
+    executeQuery(dbHandle, query);
 
     mixed result;
 
     do
     {
-        result = db_fetch(dbHandle);
+        result = fetchResult(dbHandle);
         if (result)
         {
             ret["traits"][result[1]] = ([
@@ -51,8 +51,8 @@ protected nomask mapping getTemporaryTraits(int playerId, int dbHandle)
     string query = sprintf("select traitList from temporaryTraits "
         "where playerid = '%d'", playerId);
 
-    db_exec(dbHandle, query);
-    mixed result = db_fetch(dbHandle);
+    executeQuery(dbHandle, query);
+    mixed result = fetchResult(dbHandle);
 
     if (result)
     {
@@ -71,27 +71,21 @@ protected nomask void saveTraits(int dbHandle, int playerId, mapping playerData)
         string *traits = m_indices(playerData["traits"]);
         foreach(string trait in traits)
         {
-            string query = sprintf("call saveTraits("
-                "%d,'%s','%s',%d,%d,'%s','%s');",
+            callProcedure(dbHandle, "saveTraits", ({
                 playerId,
-                sanitizeString(trait),
-                sanitizeString(playerData["traits"][trait]["name"]),
+                trait,
+                convertString(playerData["traits"][trait]["name"]),
                 playerData["traits"][trait]["added"],
                 playerData["traits"][trait]["end time"],
-                sanitizeString(playerData["traits"][trait]["expire message"] || ""),
-                sanitizeString(playerData["traits"][trait]["triggering research"] || ""));
-            db_exec(dbHandle, query);
-            mixed result = db_fetch(dbHandle);
+                playerData["traits"][trait]["expire message"] || "",
+                playerData["traits"][trait]["triggering research"] || "" }));
         }
     }
 
     if (member(playerData, "temporaryTraits") &&
         sizeof(playerData["temporaryTraits"]))
     {
-        string query = sprintf("call saveTemporaryTraits(%d,'%s');",
-            playerId, sanitizeString(playerData["temporaryTraits"]));
-
-        db_exec(dbHandle, query);
-        mixed result = db_fetch(dbHandle);
+        callProcedure(dbHandle, "saveTemporaryTraits", 
+            ({ playerId, playerData["temporaryTraits"] }));
     }
 }
@@ -12,12 +12,12 @@ protected nomask mapping getWizardLevel(int playerId, int dbHandle)
     string query = sprintf("select type from wizardTypes "
         "inner join wizards on wizards.typeId = wizardTypes.id "
         "and playerid = '%d'", playerId);
-    db_exec(dbHandle, query);
+    executeQuery(dbHandle, query);
 
     mixed result;
     do
     {
-        result = db_fetch(dbHandle);
+        result = fetchResult(dbHandle);
         if (result)
         {
             ret["wizard level"] = result[0];
@@ -32,11 +32,7 @@ protected nomask void saveWizardLevel(int dbHandle, int playerId, mapping player
 {
     if (member(playerData, "wizard level"))
     {
-        string query = sprintf("call saveWizardLevel(%d,'%s');",
-            playerId,
-            sanitizeString(playerData["wizard level"] || ""));
-
-        db_exec(dbHandle, query);
-        mixed result = db_fetch(dbHandle);
+        callProcedure(dbHandle, "saveWizardLevel", 
+            ({ playerId, playerData["wizard level"] || "" }));
     }
 }
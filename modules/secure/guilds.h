@@ -6,6 +6,10 @@
 private mapping guilds = ([]);
 private int unassignedExperience;
 
+// bonus -> ([ guild: amount ]) for the guilds above. It is thrown away
+// whenever a guild is joined or left or a level or rank changes.
+private nosave mapping guildBonusTable = ([]);
+
 /////////////////////////////////////////////////////////////////////////////
 static nomask void loadGuilds(mapping data, object persistence)
 {
@@ -14,6 +18,7 @@ static nomask void loadGuilds(mapping data, object persistence)
         unassignedExperience = persistence->extractSaveData("unassignedExperience", data);
 
         guilds = persistence->extractSavedMapping("guilds", data);
+        guildBonusTable = ([]);
 
         if (sizeof(guilds))
         {
@@ -50,7 +50,7 @@ static nomask void loadInventory(mapping data, object persistence)
                     object itemObject = clone_object(regreplace(item, "#[0-9]+$", ".c", 1));
                     if (itemObject && objectp(itemObject))
                     {
-                        itemObject->set("all", items[item]["data"]);
+                        itemObject->set("delta", items[item]["data"]);
                         move_object(itemObject, this_object());
 
                         if (items[item]["isEquipped"] && 
@@ -87,7 +87,7 @@ static nomask mapping sendInventory()
             if (find_object(object_name(registeredObject)))
             {
                 ret["inventory"][object_name(registeredObject)] = ([
-                    "data":registeredObject->query("all"),
+                    "data":registeredObject->query("delta"),
                     "isEquipped": 1
                 ]);
             }
@@ -99,7 +99,7 @@ static nomask mapping sendInventory()
         foreach(object inventoryObject in inventoryObjects)
         {
             ret["inventory"][object_name(inventoryObject)] = ([
-                "data":inventoryObject->query("all"),
+                "data":inventoryObject->query("delta"),
                 "isEquipped": (member(m_values(itemRegistry["equipped"]), inventoryObject) > -1)
             ]);
         }
@@ -3,6 +3,35 @@
 //                      the accompanying LICENSE file for details.
 //*****************************************************************************
 
+// Logins that are waiting on the database, mapped to the callbacks that will
+// be handed the player object once its data has arrived. Every login for a
+// name that is already being loaded waits on that same player object.
+private nosave mapping pendingPlayerTypes = ([]);
+private nosave mapping pendingLogins = ([]);
+private nosave string ObjectRegistry = "/lib/core/objectRegistry.c";
+private nosave string BackendRegistry =
+    "/lib/modules/secure/dataServices/backends/backendRegistry.c";
+
+/////////////////////////////////////////////////////////////////////////////
+public void reset(int arg)
+{
+    // The login blueprint is the first part of the lib that gets loaded,
+    // so this is where compiling every trait and research item and the
+    // world clock are started.
+    if (!arg && !clonep(this_object()))
+    {
+        load_object(ObjectRegistry)->preloadObjects();
+        load_object("/lib/dictionaries/environmentDictionary.c")->
+            startWorldClock();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+protected object dataAccess()
+{
+    return load_object("/lib/modules/secure/dataAccess.c");
+}
+
 /////////////////////////////////////////////////////////////////////////////
 private nomask void movePlayerToStart(object player)
 {
@@ -45,39 +74,41 @@ private nomask object checkIfPlayerObjectExists(string name)
 }
 
 /////////////////////////////////////////////////////////////////////////////
-private nomask object loadNewPlayerObject(string name)
+private nomask int isWizardType(string playerType)
+{
+    return member(({ "owner", "god", "demigod", "archwizard", "sage",
+        "elder", "admin", "senior", "highwizard", "emeritus", "creator",
+        "wizard", "apprentice" }), playerType) > -1;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask object createPlayerObject(string playerType)
 {
     object ret = 0;
-    object dataAccess = load_object("/lib/modules/secure/dataAccess.c");
-    switch (dataAccess->playerType(name))
-    {
-        case "owner":
-        case "god":
-        case "demigod":
-        case "archwizard":
-        case "sage":
-        case "elder":
-        case "admin":
-        case "senior":
-        case "highwizard":
-        case "emeritus":
-        case "creator":
-        case "wizard":
-        case "apprentice":
-        {
-            ret = clone_object("/lib/realizations/wizard.c");
-            ret->restore(name);
-            movePlayerToStart(ret);
-            break;
-        }
-        default:
-        {
-            ret = clone_object("/lib/realizations/player.c");
-            ret->registerEvent(clone_object(
-                "/lib/modules/creation/initializePlayer.c"));
-            ret->restore(name);
-            break;
-        }
+    if (isWizardType(playerType))
+    {
+        ret = clone_object("/lib/realizations/wizard.c");
+    }
+    else
+    {
+        ret = clone_object("/lib/realizations/player.c");
+        ret->registerEvent(clone_object(
+            "/lib/modules/creation/initializePlayer.c"));
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask object loadNewPlayerObject(string name)
+{
+    string playerType = dataAccess()->playerType(name);
+
+    object ret = createPlayerObject(playerType);
+    ret->restore(name);
+
+    if (isWizardType(playerType))
+    {
+        movePlayerToStart(ret);
     }
     return ret;
 }
@@ -100,11 +131,122 @@ public nomask void reportUserLogin(object user)
 public nomask object getPlayerObject(string name)
 {
     object ret = checkIfPlayerObjectExists(name);
-    if (!ret)
+
+    // An asynchronous backend cannot hand back the player's data before
+    // this returns, so those logins must go through requestPlayerObject.
+    if (!ret && !load_object(BackendRegistry)->activeBackendIsAsynchronous())
     {
         ret = loadNewPlayerObject(name);
     }
 
-    call_out("reportUserLogin", 1, ret);
+    if (ret)
+    {
+        call_out("reportUserLogin", 1, ret);
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void playerObjectRestored(object player, string error)
+{
+    if (member(pendingLogins, player))
+    {
+        closure *callbacks = pendingLogins[player][0];
+        int isWizard = pendingLogins[player][1];
+        m_delete(pendingLogins, player);
+
+        // The player's data could not be read, so the login is abandoned
+        // rather than letting them play (and save) an empty character.
+        if (error)
+        {
+            destruct(player);
+        }
+        else
+        {
+            if (isWizard)
+            {
+                movePlayerToStart(player);
+            }
+            call_out("reportUserLogin", 1, player);
+        }
+
+        foreach(closure onLoaded in callbacks)
+        {
+            funcall(onLoaded, error ? 0 : player);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void playerTypeLoaded(mixed playerType, string name)
+{
+    if (member(pendingPlayerTypes, name))
+    {
+        closure *callbacks = pendingPlayerTypes[name];
+        m_delete(pendingPlayerTypes, name);
+
+        if (stringp(playerType))
+        {
+            object player = createPlayerObject(playerType);
+            pendingLogins[player] = ({ callbacks, isWizardType(playerType),
+                name });
+
+            string error = catch (player->restore(name,
+                #'playerObjectRestored); nolog);
+            if (error)
+            {
+                playerObjectRestored(player, error);
+            }
+        }
+        else
+        {
+            foreach(closure onLoaded in callbacks)
+            {
+                funcall(onLoaded, 0);
+            }
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask object playerBeingRestored(string name)
+{
+    object ret = 0;
+    foreach(object player, mixed *login in pendingLogins)
+    {
+        if (player && (login[2] == name))
+        {
+            ret = player;
+        }
+    }
     return ret;
 }
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void requestPlayerObject(string name, closure onLoaded)
+{
+    // Continuation-style counterpart to getPlayerObject: the database is
+    // never waited on, onLoaded is called with the player once it is ready
+    // or with 0 if the player's data could not be read.
+    object player = checkIfPlayerObjectExists(name);
+    object restoringPlayer = playerBeingRestored(name);
+
+    if (player)
+    {
+        call_out("reportUserLogin", 1, player);
+        funcall(onLoaded, player);
+    }
+    else if (restoringPlayer)
+    {
+        pendingLogins[restoringPlayer][0] += ({ onLoaded });
+    }
+    else if (member(pendingPlayerTypes, name))
+    {
+        pendingPlayerTypes[name] += ({ onLoaded });
+    }
+    else
+    {
+        pendingPlayerTypes[name] = ({ onLoaded });
+        dataAccess()->playerTypeAsync(name, #'playerTypeLoaded);
+    }
+}
@@ -6,6 +6,23 @@ virtual inherit "/lib/core/thing.c";
 
 private nosave object dataAccess;
 
+// The name being restored and the callbacks waiting for it to finish. A
+// restore requested while another is in flight waits on the same data.
+private nosave string restoringName = 0;
+private nosave closure *onRestored = ({});
+
+// Kills are buffered by the combat statistics buffer and written in batches.
+// The aggregates are kept current here as kills happen so that prerequisite
+// checks never hit the database.
+private nosave string CombatStatisticsBuffer =
+    "/lib/modules/secure/combatStatisticsBuffer.c";
+private nosave mapping combatStatistics = ([
+    "kills": ([]),
+    "races": ([]),
+    "nemesis": 0,
+    "best kill": 0
+]);
+
 /////////////////////////////////////////////////////////////////////////////
 private nomask object DataAccess()
 {
@@ -39,17 +56,46 @@ private nomask mapping getPlayerInfo()
     return ret;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+private nomask void flushCombatStatistics(string name)
+{
+    if (name)
+    {
+        load_object(CombatStatisticsBuffer)->flushKills(lower_case(name));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int isDatabaseError(mixed result)
+{
+    return mappingp(result) && member(result, "database error");
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void saveCompleted(mixed result)
+{
+    if (!isDatabaseError(result))
+    {
+        this_object()->notify("onSaveSucceeded");
+    }
+}
+
 /////////////////////////////////////////////////////////////////////////////
 public nomask void save()
 {
     if (canAccessDatabase(previous_object()))
     {
+        flushCombatStatistics(this_object()->Name());
+
         mapping playerData = getPlayerInfo();
         if (sizeof(playerData))
         {
-            DataAccess()->savePlayerData(playerData);
+            DataAccess()->savePlayerDataAsync(playerData, #'saveCompleted);
+        }
+        else
+        {
+            saveCompleted();
         }
-        this_object()->notify("onSaveSucceeded");
     }
     else
     {
@@ -119,23 +165,90 @@ private nomask void setPlayerInfo(mapping playerData)
 }
 
 /////////////////////////////////////////////////////////////////////////////
-public nomask void restore(string name)
+private nomask void applyRestoredData(mapping playerData, string name)
+{
+    if (sizeof(playerData) > 1)
+    {
+        if (mappingp(playerData["combatStatistics"]))
+        {
+            combatStatistics = playerData["combatStatistics"];
+        }
+        setPlayerInfo(playerData);
+        this_object()->notifySynchronous("onRestoreSucceeded");
+    }
+    else
+    {
+        this_object()->Name(name);
+        this_object()->notifySynchronous("onRestoreFailed");
+    }
+    set_living_name(name);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void restoreCompleted(mixed playerData, string name)
+{
+    // A database failure is not the same as the player not existing -
+    // treating it that way would overwrite their data with a new character
+    // the next time they were saved. The restore is abandoned instead.
+    string error = isDatabaseError(playerData) ?
+        playerData["database error"] : 0;
+
+    // The restore is over as far as anyone waiting on it is concerned, even
+    // if applying the data fails, so that this object is never left
+    // restoring. Such a failure is handed to the callbacks like any other.
+    closure *callbacks = onRestored;
+    onRestored = ({});
+    restoringName = 0;
+
+    if (!error)
+    {
+        error = catch (applyRestoredData(playerData, name));
+        if (error && (error[0] == '*'))
+        {
+            error = error[1..];
+        }
+    }
+
+    foreach(closure callback in callbacks)
+    {
+        funcall(callback, this_object(), error);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask varargs void restore(string name, closure callback)
 {
     if (canAccessDatabase(previous_object()))
     {
-        mapping playerData = DataAccess()->getPlayerData(name);
+        // The data may arrive after this call returns when the database
+        // backend is asynchronous. The callback, if any, is handed this
+        // object and, if the database could not be read, the error once
+        // the restore has finished.
+        if (restoringName && (restoringName != name))
+        {
+            raise_error(sprintf("ERROR in persistence.c: Cannot restore %s "
+                "while %s is being restored.\n", name, restoringName));
+        }
 
-        if (sizeof(playerData) > 1)
+        if (callback)
         {
-            setPlayerInfo(playerData);
-            this_object()->notifySynchronous("onRestoreSucceeded");
+            onRestored += ({ callback });
         }
-        else
+
+        if (!restoringName)
         {
-            this_object()->Name(name);
-            this_object()->notifySynchronous("onRestoreFailed");
+            flushCombatStatistics(name);
+            restoringName = name;
+
+            string error = catch (DataAccess()->getPlayerDataAsync(name,
+                #'restoreCompleted); nolog);
+            if (error)
+            {
+                onRestored = ({});
+                restoringName = 0;
+                raise_error((error[0] == '*') ? error[1..] : error);
+            }
         }
-        set_living_name(name);
     }
     else
     {
@@ -151,44 +264,106 @@ public nomask string playerType(string name)
     return DataAccess()->playerType(name);
 }
 
+/////////////////////////////////////////////////////////////////////////////
+private nomask int killRanksHigher(string foeKey, string currentKey,
+    string primary, string secondary)
+{
+    int ret = !currentKey || !member(combatStatistics["kills"], currentKey);
+
+    if (!ret && (foeKey != currentKey))
+    {
+        mapping foe = combatStatistics["kills"][foeKey];
+        mapping current = combatStatistics["kills"][currentKey];
+
+        ret = (foe[primary] > current[primary]) ||
+            ((foe[primary] == current[primary]) &&
+            (foe[secondary] > current[secondary]));
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void addKillToCombatStatistics(string foeKey, string foeName,
+    int foeLevel, string race)
+{
+    if (!member(combatStatistics["kills"], foeKey))
+    {
+        combatStatistics["kills"][foeKey] = ([
+            "name": foeName,
+            "level": foeLevel,
+            "key": foeKey,
+            "times killed": 0
+        ]);
+    }
+    combatStatistics["kills"][foeKey]["times killed"]++;
+
+    if (killRanksHigher(foeKey, combatStatistics["nemesis"],
+        "times killed", "level"))
+    {
+        combatStatistics["nemesis"] = foeKey;
+    }
+    if (killRanksHigher(foeKey, combatStatistics["best kill"],
+        "level", "times killed"))
+    {
+        combatStatistics["best kill"] = foeKey;
+    }
+
+    if (race)
+    {
+        combatStatistics["races"][race]++;
+    }
+}
+
 /////////////////////////////////////////////////////////////////////////////
 public nomask void saveCombatStatistics(object player, object foe)
 {
     string foeKey = program_name(foe) + "#" + foe->Name();
-    string playerName = player->Name();
+    string race = (function_exists("Race", foe) && foe->Race()) ?
+        foe->Race() : 0;
+
+    addKillToCombatStatistics(foeKey, foe->Name(), foe->effectiveLevel(),
+        race);
 
-    DataAccess()->saveCombatStatistics(playerName, foeKey,
-        foe->Name(), foe->effectiveLevel());
+    load_object(CombatStatisticsBuffer)->addKill(
+        lower_case(this_object()->Name()), foeKey, foe->Name(),
+        foe->effectiveLevel(), race);
+}
 
-    if (function_exists("Race", foe) && foe->Race())
+/////////////////////////////////////////////////////////////////////////////
+private nomask mapping getKillDetails(string foeKey)
+{
+    mapping ret = ([]);
+    if (foeKey && member(combatStatistics["kills"], foeKey))
     {
-        DataAccess()->saveCombatStatisticsForRace(playerName, foe->Race());
+        ret = combatStatistics["kills"][foeKey] + ([]);
     }
+    return ret;
 }
 
 /////////////////////////////////////////////////////////////////////////////
 public nomask int bestKillMeetsLevel(int level)
 {
-    return DataAccess()->bestKillMeetsLevel(this_object()->Name(), level);
+    mapping bestKill = getKillDetails(combatStatistics["best kill"]);
+    return sizeof(bestKill) && (bestKill["level"] >= level);
 }
 
 /////////////////////////////////////////////////////////////////////////////
 public nomask int racialKillsMeetCount(string race, int timesKilled)
 {
-    return DataAccess()->racialKillsMeetCount(
-        this_object()->Name(), race, timesKilled);
+    return member(combatStatistics["races"], race) &&
+        (combatStatistics["races"][race] >= timesKilled);
 }
 
 /////////////////////////////////////////////////////////////////////////////
 public nomask mapping getNemesis()
 {
-    return DataAccess()->getNemesis(this_object()->Name()) + ([]);
+    return getKillDetails(combatStatistics["nemesis"]);
 }
 
 /////////////////////////////////////////////////////////////////////////////
 public nomask mapping getBestKill()
 {
-    return DataAccess()->getBestKill(this_object()->Name()) + ([]);
+    return getKillDetails(combatStatistics["best kill"]);
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -15,6 +15,16 @@ private string *openResearchTrees = ({});
 private mapping researchChoices = ([]);
 private int researchPoints = 0;
 
+// bonus -> ([ "amounts": ([ research item: amount ]),
+//             "limited": ([ research item: 1 ]) ])
+// The research items that grant each bonus, built a bonus at a time and
+// thrown away when research is added or completes. Limited skill bonuses
+// depend on the target, so they are calculated when they are applied.
+private nosave mapping researchBonusIndex = ([]);
+
+// Sustained research that is currently active
+private nosave mapping activeSustainedResearch = ([]);
+
 /////////////////////////////////////////////////////////////////////////////
 static nomask void loadResearch(mapping data, object persistence)
 {
@@ -28,6 +38,9 @@ static nomask void loadResearch(mapping data, object persistence)
             openResearchTrees = openTrees;
         }
         research = persistence->extractSavedMapping("research", data);
+        researchBonusIndex = ([]);
+        activeSustainedResearch = filter(research,
+            (: mappingp($2) && $2["sustained active"] :));
 
         string *researchItems = m_indices(research);
         if (sizeof(researchItems))
@@ -5,12 +5,27 @@
 private mapping traits = ([]);
 private string *temporaryTraits = ({});
 
+// bonus -> ([ "total": <sum of static amounts>, "static": ([ trait: amount ]),
+//            "limited": ([ trait: amount ]) ])
+// Built a bonus at a time from the traits above and thrown away whenever
+// they change. Limited traits still have to be checked when queried.
+private nosave mapping traitBonusTable = ([]);
+
+// The traits above indexed by root and by type, along with how each of them
+// changes this living's opinion of others: root -> ([ trait: opinion ]).
+// Rebuilt on first use after the traits change.
+private nosave mapping traitRootIndex = 0;
+private nosave mapping traitTypeIndex = 0;
+private nosave mapping traitOpinionIndex = 0;
+
 /////////////////////////////////////////////////////////////////////////////
 static nomask void loadTraits(mapping data, object persistence)
 {
     if (isValidPersistenceObject(persistence))
     {
         traits = persistence->extractSavedMapping("traits", data);
+        traitBonusTable = ([]);
+        traitRootIndex = 0;
         string *traitList = m_indices(traits);
         if (sizeof(traitList))
         {
@@ -19,11 +19,53 @@ public nomask int isTraitOf(string trait)
             member(traits, trait) && mappingp(traits[trait]));
 }
 
+/////////////////////////////////////////////////////////////////////////////
+private nomask void buildTraitIndex()
+{
+    traitRootIndex = ([]);
+    traitTypeIndex = ([]);
+    traitOpinionIndex = ([]);
+
+    foreach(string trait in m_indices(traits))
+    {
+        mapping classification = traitDictionary()->traitClassification(trait);
+        if (classification)
+        {
+            string root = classification["root"];
+            if (root)
+            {
+                traitRootIndex[root] = member(traitRootIndex, root) ?
+                    traitRootIndex[root] + ({ trait }) : ({ trait });
+            }
+
+            string type = classification["type"];
+            if (type)
+            {
+                traitTypeIndex[type] = member(traitTypeIndex, type) ?
+                    traitTypeIndex[type] + ({ trait }) : ({ trait });
+            }
+        }
+
+        foreach(string root, int opinion in 
+            traitDictionary()->traitOpinionAffinity(trait))
+        {
+            if (!member(traitOpinionIndex, root))
+            {
+                traitOpinionIndex[root] = ([]);
+            }
+            traitOpinionIndex[root][trait] = opinion;
+        }
+    }
+}
+
 /////////////////////////////////////////////////////////////////////////////
 public nomask int hasTraitOfRoot(string root)
 {
-    return (sizeof(filter(m_indices(traits),
-        (: traitDictionary()->traitIsOfRoot($1, $2) :), root)));
+    if (!mappingp(traitRootIndex))
+    {
+        buildTraitIndex();
+    }
+    return member(traitRootIndex, root);
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -50,27 +92,20 @@ private nomask int traitHasResearchTree(string trait)
     return ret;
 }
 
-/////////////////////////////////////////////////////////////////////////////
-private nomask int traitAffectedByType(string trait, string rootType)
-{
-    object traitObj = traitDictionary()->traitObject(trait);
-
-    return isTraitOf(trait) && traitObj && getDictionary("research") &&
-        traitObj->query("root") && traitObj->query("opposing root") &&
-        (member(({ traitObj->query("root"), traitObj->query("opposing root") }),
-            rootType) > -1);
-}
-
 /////////////////////////////////////////////////////////////////////////////
 public nomask varargs string *Traits(string type)
 {
     string *traitList = m_indices(traits);
     if (type)
     {
-        traitList = filter(traitList,
-            (: traitDictionary()->traitIsOfType($1, $2) :), type);
+        if (!mappingp(traitRootIndex))
+        {
+            buildTraitIndex();
+        }
+        traitList = member(traitTypeIndex, type) ?
+            traitTypeIndex[type] + ({}) : ({});
     }
-    return m_indices(traits);
+    return traitList;
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -125,6 +160,8 @@ public nomask int addTrait(string trait)
         {
             traits[trait]["bonuses"] = bonuses;
         }
+        traitBonusTable = ([]);
+        traitRootIndex = 0;
 
         object events = getService("events");
         if(events && objectp(events))
@@ -144,6 +181,8 @@ public nomask int removeTrait(string trait)
     if(isTraitOf(trait) && isValidTrait(trait))
     {
         m_delete(traits, trait);
+        traitBonusTable = ([]);
+        traitRootIndex = 0;
 
         if(member(temporaryTraits, trait) > -1)
         {
@@ -221,40 +260,96 @@ public nomask int traitsAttributeBonus(string attribute)
 }
 
 /////////////////////////////////////////////////////////////////////////////
-public nomask int traitsBonusTo(string bonus)
+private nomask mapping compileTraitBonus(string bonus)
 {
-    int ret = 0;
-    
-    if(function_exists(bonus, traitDictionary()))
+    mapping ret = ([ "total": 0, "static": ([]), "limited": ([]) ]);
+
+    string method = 0;
+    string bonusString = 0;
+    if (function_exists(bonus, traitDictionary()))
     {
-        string bonusString =
-            getDictionary("bonuses")->getBonusFromFunction(bonus);
+        method = bonus;
+        bonusString = getDictionary("bonuses")->getBonusFromFunction(bonus);
+    }
+    else if (function_exists("BonusSkillModifier", traitDictionary()))
+    {
+        method = "BonusSkillModifier";
+        bonusString = "bonus " + bonus;
+    }
 
+    if (method && bonusString)
+    {
         string *traitItems = filter(m_indices(traits),
             (: (member(traits[$1], "bonuses") &&
                 sizeof(regexp(traits[$1]["bonuses"], $2))) :), bonusString);
 
         foreach(string trait in traitItems)
+        {
+            int amount = (method == bonus) ?
+                call_other(traitDictionary(), method, trait) :
+                call_other(traitDictionary(), method, trait, bonus);
+
+            if (amount && isTraitOf(trait) &&
+                traitDictionary()->traitEffectIsLimited(trait))
+            {
+                ret["limited"][trait] = amount;
+            }
+            else if (amount)
+            {
+                ret["static"][trait] = amount;
+                ret["total"] += amount;
+            }
+        }
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask mapping traitBonusEntry(string bonus)
+{
+    if (!member(traitBonusTable, bonus))
+    {
+        traitBonusTable[bonus] = compileTraitBonus(bonus);
+    }
+    return traitBonusTable[bonus];
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask mapping traitsBonusSources(string bonus)
+{
+    mapping ret = ([]);
+
+    if (bonus && stringp(bonus))
+    {
+        mapping entry = traitBonusEntry(bonus);
+        ret = entry["static"] + ([]);
+
+        foreach(string trait, int amount in entry["limited"])
         {
             if (canApplyLimitedTrait(trait, bonus))
             {
-                ret += call_other(traitDictionary(), bonus, trait);            
+                ret[trait] = amount;
             }
         }
     }
-    else if(function_exists("BonusSkillModifier", traitDictionary()))
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask int traitsBonusTo(string bonus)
+{
+    int ret = 0;
+
+    if (bonus && stringp(bonus))
     {
-        string *traitItems = filter(m_indices(traits),
-            (: (member(traits[$1], "bonuses") &&
-                sizeof(regexp(traits[$1]["bonuses"],
-                "bonus " + $2))) :), bonus);
+        mapping entry = traitBonusEntry(bonus);
+        ret = entry["total"];
 
-        foreach(string trait in traitItems)
+        foreach(string trait, int amount in entry["limited"])
         {
-            if(canApplyLimitedTrait(trait, bonus))
+            if (canApplyLimitedTrait(trait, bonus))
             {
-                ret += call_other(traitDictionary(), "BonusSkillModifier", 
-                    trait, bonus);
+                ret += amount;
             }
         }
     }
@@ -285,44 +380,39 @@ public nomask int opinionModifier(object target)
 {
     int ret = 0;
 
-    string *appliedModifiers = ({});
     if(target && objectp(target))
     {
+        if (!mappingp(traitRootIndex))
+        {
+            buildTraitIndex();
+        }
+
+        mapping appliedModifiers = ([]);
         string *targetTraits = target->Traits();
         if(targetTraits && sizeof(targetTraits))
         {
             foreach(string targetTrait in targetTraits)
             {
-                object targetTraitObj = traitDictionary()->traitObject(targetTrait);
-                string targetRoot = targetTraitObj->query("root");
-                string *affectingTraits = filter(m_indices(traits), 
-                    #'traitAffectedByType, 
-                    targetRoot);
+                mapping targetDetails = 
+                    traitDictionary()->traitClassification(targetTrait) || ([]);
+                string targetRoot = targetDetails["root"];
 
-                if(affectingTraits && sizeof(affectingTraits))
+                if (targetRoot && member(traitOpinionIndex, targetRoot))
                 {
-                    foreach(string affectingTrait in affectingTraits)
+                    foreach(string affectingTrait, int opinion in 
+                        traitOpinionIndex[targetRoot])
                     {
-                        object affectingObj = traitDictionary()->traitObject(affectingTrait);
-                        
-                        if(member(appliedModifiers, affectingTrait) == -1)
+                        if(!member(appliedModifiers, affectingTrait))
                         {
-                            if(targetRoot == affectingObj->query("root"))
-                            {
-                                ret += affectingObj->query("opinion");
-                            }
-                            else if (targetRoot == affectingObj->query("opposing root"))
-                            {
-                                ret += affectingObj->query("opposing opinion");
-                            }
-                            appliedModifiers += ({ affectingTrait });
+                            ret += opinion;
+                            appliedModifiers[affectingTrait] = 1;
                         }
                     }
                 }
-                else if (targetTraitObj->query("opinion") &&
-                    !targetTraitObj->query("opposing opinion"))
+                else if (targetDetails["opinion"] &&
+                    !targetDetails["opposing opinion"])
                 {
-                    ret += targetTraitObj->query("opinion");
+                    ret += targetDetails["opinion"];
                 }
             }
         }
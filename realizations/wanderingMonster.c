@@ -7,10 +7,91 @@
 //*****************************************************************************
 virtual inherit "/lib/realizations/monster.c";
 
+// The monster walks from one waypoint to the next, taking a single step
+// every WanderDelay heart beats. Routes come from the navigation
+// dictionary, so each leg is a cached lookup rather than a random walk.
+private string *wanderingWaypoints = ({});
+private int currentWaypoint = 0;
+private nosave int WanderDelay = 5;
+private nosave int heartBeatsUntilMove = 0;
+
 /////////////////////////////////////////////////////////////////////////////
 public nomask int isRealizationOfWanderingMonster()
 {
     return 1;
 }
 
-//TODO [224]: To, in fact, do.
+/////////////////////////////////////////////////////////////////////////////
+public void reset(int arg)
+{
+    "monster"::reset(arg);
+    if (!arg)
+    {
+        registerHeartBeat("wander");
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void addWaypoint(string location)
+{
+    if (stringp(location) && (file_size(location) > 0))
+    {
+        wanderingWaypoints += ({ location });
+        set_heart_beat(1);
+    }
+    else
+    {
+        raise_error(sprintf("ERROR in wanderingMonster.c: '%s' is not a "
+            "valid location.\n", to_string(location)));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask string *waypoints()
+{
+    return wanderingWaypoints + ({});
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask string nextWanderingStep()
+{
+    string ret = 0;
+    object navigation = getDictionary("navigation");
+
+    if (navigation && environment() && sizeof(wanderingWaypoints))
+    {
+        // Skip past any waypoints that have been reached or that cannot
+        // currently be reached, but only go around the list once.
+        for (int i = 0; !ret && (i < sizeof(wanderingWaypoints)); i++)
+        {
+            ret = navigation->nextStep(environment(),
+                wanderingWaypoints[currentWaypoint]);
+
+            if (!ret)
+            {
+                currentWaypoint =
+                    (currentWaypoint + 1) % sizeof(wanderingWaypoints);
+            }
+        }
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+static nomask void wanderHeartBeat()
+{
+    if (heartBeatsUntilMove > 0)
+    {
+        heartBeatsUntilMove--;
+    }
+    else if (!this_object()->getTargetToAttack())
+    {
+        heartBeatsUntilMove = WanderDelay;
+
+        string direction = nextWanderingStep();
+        if (direction)
+        {
+            command(direction);
+        }
+    }
+}
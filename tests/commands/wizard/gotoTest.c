@@ -75,6 +75,34 @@ void CanGoToFileBasedLocationWithoutDotCInCurrentDirectory()
         environment(Wizard));
 }
 
+/////////////////////////////////////////////////////////////////////////////
+void CanGoToLandmark()
+{
+    load_object("/lib/dictionaries/navigationDictionary.c")->registerLandmark(
+        "oakhaven", "/lib/tests/support/environment/toLocation.c");
+
+    ExpectEq(0, environment(Wizard));
+    ExpectTrue(Wizard->executeCommand("goto oakhaven"));
+    ExpectEq(load_object("/lib/tests/support/environment/toLocation.c"),
+        environment(Wizard));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void CanGoToLandmarkRegisteredByClonedRoom()
+{
+    object room = clone_object("/lib/tests/support/environment/testEnvironment.c");
+    room->testAddLandmark("the old mill");
+
+    ExpectEq(0, environment(Wizard));
+    ExpectTrue(Wizard->executeCommand("goto the old mill"));
+    ExpectEq(room, environment(Wizard));
+
+    move_object(Wizard, Room);
+    destruct(room);
+    ExpectFalse(Wizard->executeCommand("goto the old mill"));
+    ExpectEq(Room, environment(Wizard));
+}
+
 /////////////////////////////////////////////////////////////////////////////
 void CanGoToPlayer()
 {
@@ -0,0 +1,45 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+inherit "/lib/tests/framework/testFixture.c";
+
+object Registry;
+
+/////////////////////////////////////////////////////////////////////////////
+void Setup()
+{
+    Registry = load_object("/lib/core/dictionaryRegistry.c");
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void CleanUp()
+{
+    destruct(Registry);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void GetDictionaryReturnsDictionaryBlueprint()
+{
+    object dictionary = Registry->getDictionary("environment");
+    ExpectEq(load_object("/lib/dictionaries/environmentDictionary.c"), dictionary);
+    ExpectEq(dictionary, Registry->getDictionary("environment"));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void GetDictionaryReturnsZeroForInvalidDictionaries()
+{
+    ExpectFalse(Registry->getDictionary("blarg"));
+    ExpectFalse(Registry->getDictionary(0));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void GetDictionaryResolvesAgainAfterBlueprintIsDestructed()
+{
+    object dictionary = Registry->getDictionary("environment");
+    destruct(dictionary);
+
+    dictionary = Registry->getDictionary("environment");
+    ExpectTrue(dictionary);
+    ExpectEq(find_object("/lib/dictionaries/environmentDictionary"), dictionary);
+}
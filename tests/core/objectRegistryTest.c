@@ -0,0 +1,123 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+inherit "/lib/tests/framework/testFixture.c";
+
+object Registry;
+string Manifest = "/lib/tests/support/preloadManifest.txt";
+
+/////////////////////////////////////////////////////////////////////////////
+void Setup()
+{
+    Registry = load_object("/lib/tests/support/core/testObjectRegistry.c");
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void CleanUp()
+{
+    destruct(Registry);
+    if (file_size(Manifest) > -1)
+    {
+        rm(Manifest);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void GetObjectReturnsValidatedBlueprint()
+{
+    object trait = Registry->getObject("trait",
+        "lib/modules/traits/educational/articulate.c");
+    ExpectEq(load_object("/lib/modules/traits/educational/articulate.c"), trait);
+    ExpectEq(trait, Registry->getObject("trait",
+        "/lib/modules/traits/educational/articulate.c"));
+
+    ExpectEq(load_object("/lib/tests/support/research/testResearchA.c"),
+        Registry->getObject("research", "lib/tests/support/research/testResearchA.c"));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void GetObjectReturnsZeroForInvalidObjects()
+{
+    ExpectFalse(Registry->getObject("trait",
+        "lib/tests/support/research/testResearchA.c"));
+    ExpectFalse(Registry->getObject("research",
+        "lib/modules/traits/educational/articulate.c"));
+    ExpectFalse(Registry->getObject("trait", "lib/modules/traits/blarg.c"));
+    ExpectFalse(Registry->getObject("blarg",
+        "lib/modules/traits/educational/articulate.c"));
+    ExpectFalse(Registry->getObject("trait", 0));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void GetObjectResolvesAgainAfterBlueprintIsDestructed()
+{
+    object trait = Registry->getObject("trait",
+        "lib/modules/traits/educational/articulate.c");
+    destruct(trait);
+
+    trait = Registry->getObject("trait",
+        "lib/modules/traits/educational/articulate.c");
+    ExpectTrue(trait);
+    ExpectEq(find_object("/lib/modules/traits/educational/articulate"), trait);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void PreloadObjectsLoadsAndRegistersFilesInManifest()
+{
+    object trait = find_object("/lib/modules/traits/educational/arcane");
+    if (trait)
+    {
+        destruct(trait);
+    }
+
+    write_file(Manifest, "# traits\n"
+        "/lib/modules/traits/educational/arcane.c\n\n"
+        "lib/tests/support/research/testResearchA.c\n"
+        "/lib/modules/traits/blarg.c\n");
+
+    ExpectTrue(Registry->preloadObjects());
+    ExpectEq(3, Registry->preloadStatus()["pending"]);
+
+    while (Registry->processPreload());
+
+    mapping status = Registry->preloadStatus();
+    ExpectEq(0, status["pending"]);
+    ExpectEq(2, status["loaded"]);
+    ExpectEq(({ "/lib/modules/traits/blarg.c" }), m_indices(status["failed"]));
+
+    trait = find_object("/lib/modules/traits/educational/arcane");
+    ExpectTrue(trait);
+    ExpectEq(trait, Registry->getObject("trait",
+        "lib/modules/traits/educational/arcane.c"));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void PreloadObjectsDoesNothingWithoutManifest()
+{
+    ExpectFalse(Registry->preloadObjects());
+    ExpectFalse(Registry->preloadStatus());
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void GeneratePreloadManifestListsTraitAndResearchFiles()
+{
+    int count = Registry->generatePreloadManifest();
+    ExpectTrue(count > 0);
+
+    string *files = explode(read_file(Manifest), "\n") - ({ "" });
+    ExpectEq(count, sizeof(files));
+    ExpectTrue(member(files,
+        "/lib/modules/traits/educational/articulate.c") > -1);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void PreloadObjectsOnlyPreloadsOnce()
+{
+    write_file(Manifest, "/lib/modules/traits/educational/arcane.c\n");
+
+    ExpectTrue(Registry->preloadObjects());
+    while (Registry->processPreload());
+    ExpectFalse(Registry->preloadObjects());
+    ExpectEq(1, Registry->preloadStatus()["loaded"]);
+}
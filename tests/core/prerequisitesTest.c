@@ -266,6 +266,24 @@ void CheckPrerequsistesCorrectlyHandlesOpinionChecks()
     ExpectTrue(Prerequisite->checkPrerequisites(Researcher, "group a", owner), "check passes for group a");
 }
 
+/////////////////////////////////////////////////////////////////////////////
+void CachedPrerequisiteChecksAreRefreshedWhenFactsChange()
+{
+    destruct(Researcher);
+    Researcher = clone_object("/lib/realizations/player.c");
+    Researcher->Name("Bob");
+
+    ExpectTrue(Prerequisite->AddTestPrerequisite("trait", (["type":"trait", "value" : ({ "lib/modules/traits/educational/articulate.c" })])));
+    ExpectFalse(Prerequisite->checkPrerequisites(Researcher), "check initially fails");
+    ExpectFalse(Prerequisite->checkPrerequisites(Researcher), "check still fails");
+
+    ExpectTrue(Researcher->addTrait("lib/modules/traits/educational/articulate.c"));
+    ExpectTrue(Prerequisite->checkPrerequisites(Researcher), "check passes once trait added");
+
+    ExpectTrue(Researcher->removeTrait("lib/modules/traits/educational/articulate.c"));
+    ExpectFalse(Prerequisite->checkPrerequisites(Researcher), "check fails once trait removed");
+}
+
 /////////////////////////////////////////////////////////////////////////////
 void DisplayPrerequisitesCorrectlyDisplaysQuestPrerequisites()
 {
@@ -376,6 +376,26 @@ void CanApplySkillReturnsFalseWithLimitorForWeaponNotMet()
     ExpectFalse(Specification->canApplySkill("blah", Attacker, Attacker), "limitors not met");
 }
 
+/////////////////////////////////////////////////////////////////////////////
+void CanApplySkillReflectsEquipmentChangesWithinTheSameRound()
+{
+    mapping limitor = (["equipment":"long sword"]);
+    ExpectTrue(Specification->addSpecification("limited by", limitor), "set the limitor");
+
+    object weapon = clone_object("/lib/items/weapon");
+    weapon->set("name", "blah");
+    weapon->set("weapon type", "long sword");
+    weapon->set("equipment locations", OnehandedWeapon);
+    move_object(weapon, Attacker);
+
+    ExpectTrue(weapon->equip("blah"), "weapon equip called");
+    ExpectTrue(Specification->canApplySkill("blah", Attacker, Attacker), "limitors met");
+    ExpectTrue(Specification->canApplySkill("blah", Attacker, Attacker), "limitors still met");
+
+    ExpectTrue(weapon->unequip("blah"), "weapon unequip called");
+    ExpectFalse(Specification->canApplySkill("blah", Attacker, Attacker), "limitors not met after unequip");
+}
+
 /////////////////////////////////////////////////////////////////////////////
 void CanApplySkillReturnsTrueWithLimitorForArmor()
 {
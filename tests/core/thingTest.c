@@ -0,0 +1,50 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+inherit "/lib/tests/framework/testFixture.c";
+
+object Player;
+
+/////////////////////////////////////////////////////////////////////////////
+void Setup()
+{
+    Player = clone_object("/lib/realizations/player.c");
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void CleanUp()
+{
+    destruct(Player);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void HasReturnsTrueForIntegratedModules()
+{
+    ExpectTrue(Player->has("combat"));
+    ExpectTrue(Player->has("events"));
+    ExpectTrue(Player->has("secure/persistence"));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void HasReturnsFalseForModulesNotIntegrated()
+{
+    ExpectFalse(Player->has("blarg"));
+    ExpectFalse(Player->has("player"));
+    ExpectFalse(Player->has(0));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void HasIsConsistentAcrossClones()
+{
+    object otherPlayer = clone_object("/lib/realizations/player.c");
+    ExpectTrue(otherPlayer->has("combat"));
+    ExpectFalse(otherPlayer->has("blarg"));
+    destruct(otherPlayer);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void SharedProgramServicesAreNotGivenToOtherPrograms()
+{
+    ExpectFalse(Player->sharedProgramServices());
+}
@@ -0,0 +1,83 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+inherit "/lib/tests/framework/testFixture.c";
+
+object Dictionary;
+
+/////////////////////////////////////////////////////////////////////////////
+void Setup()
+{
+    Dictionary = clone_object("/lib/dictionaries/environmentDictionary.c");
+    Dictionary->timeOfDay("noon");
+    Dictionary->season("summer");
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void CleanUp()
+{
+    destruct(Dictionary);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void WorldClockOnlyRunsOnceStarted()
+{
+    ExpectFalse(Dictionary->worldClockIsRunning());
+    ExpectTrue(Dictionary->startWorldClock());
+    ExpectTrue(Dictionary->worldClockIsRunning());
+    ExpectFalse(Dictionary->startWorldClock());
+    ExpectTrue(Dictionary->stopWorldClock());
+    ExpectFalse(Dictionary->worldClockIsRunning());
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void AdvanceWorldClockMovesToNextTimeOfDay()
+{
+    int epoch = Dictionary->descriptionEpoch();
+    Dictionary->advanceWorldClock();
+
+    ExpectEq("afternoon", Dictionary->timeOfDay());
+    ExpectEq("summer", Dictionary->season());
+    ExpectEq(epoch + 1, Dictionary->descriptionEpoch());
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void AdvanceWorldClockMovesToNextDayAfterDusk()
+{
+    Dictionary->timeOfDay("dusk");
+    Dictionary->advanceWorldClock();
+
+    ExpectEq("midnight", Dictionary->timeOfDay());
+    ExpectEq(1, Dictionary->dayOfSeason());
+    ExpectEq("summer", Dictionary->season());
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void AdvanceWorldClockChangesSeasonAfterSevenDays()
+{
+    Dictionary->timeOfDay("dusk");
+    for (int i = 0; i < 49; i++)
+    {
+        Dictionary->advanceWorldClock();
+    }
+
+    ExpectEq("midnight", Dictionary->timeOfDay());
+    ExpectEq(0, Dictionary->dayOfSeason());
+    ExpectEq("autumn", Dictionary->season());
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void TransitionsArePublishedToSubscribers()
+{
+    object subscriber = clone_object("/lib/tests/support/events/worldClockSubscriber.c");
+    ExpectTrue(Dictionary->registerEvent(subscriber));
+
+    Dictionary->timeOfDay("dawn");
+    Dictionary->timeOfDay("dawn");
+    Dictionary->season("winter");
+
+    ExpectEq(({ "time of day: noon -> dawn", "season: summer -> winter" }),
+        subscriber->transitions());
+    destruct(subscriber);
+}
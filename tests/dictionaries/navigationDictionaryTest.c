@@ -0,0 +1,135 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+inherit "/lib/tests/framework/testFixture.c";
+
+object Dictionary;
+object NorthWest;
+object NorthEast;
+object SouthWest;
+object SouthEast;
+
+/////////////////////////////////////////////////////////////////////////////
+void Setup()
+{
+    Dictionary = load_object("/lib/dictionaries/navigationDictionary.c");
+
+    NorthWest = clone_object("/lib/tests/support/environment/testEnvironment.c");
+    NorthEast = clone_object("/lib/tests/support/environment/testEnvironment.c");
+    SouthWest = clone_object("/lib/tests/support/environment/testEnvironment.c");
+    SouthEast = clone_object("/lib/tests/support/environment/testEnvironment.c");
+
+    NorthWest->testAddExit("east", object_name(NorthEast));
+    NorthWest->testAddExit("south", object_name(SouthWest));
+    NorthEast->testAddExit("west", object_name(NorthWest));
+    SouthWest->testAddExit("north", object_name(NorthWest));
+    SouthWest->testAddExit("east", object_name(SouthEast));
+    SouthEast->testAddExit("west", object_name(SouthWest));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void CleanUp()
+{
+    destruct(NorthWest);
+    destruct(NorthEast);
+    destruct(SouthWest);
+    destruct(SouthEast);
+    destruct(Dictionary);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void ExitsFromReturnsRegisteredExits()
+{
+    ExpectEq(({ "east", "south" }), sort_array(
+        m_indices(Dictionary->exitsFrom(NorthWest)), (: $1 > $2 :)));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void GetRouteReturnsShortestRoute()
+{
+    ExpectEq(({ "west", "south", "east" }),
+        Dictionary->getRoute(NorthEast, SouthEast));
+    ExpectEq(({ "west", "north" }), Dictionary->getRoute(SouthEast, NorthWest));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void GetRouteReturnsEmptyRouteForSameRoom()
+{
+    ExpectEq(({}), Dictionary->getRoute(NorthEast, NorthEast));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void GetRouteReturnsZeroWhenNoRouteExists()
+{
+    object island = clone_object("/lib/tests/support/environment/testEnvironment.c");
+    ExpectFalse(Dictionary->getRoute(NorthEast, island));
+    destruct(island);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void RoutesAreUpdatedWhenExitsChange()
+{
+    ExpectEq(({ "west", "south", "east" }),
+        Dictionary->getRoute(NorthEast, SouthEast));
+
+    NorthEast->testAddExit("south", object_name(SouthEast));
+    ExpectEq(({ "south" }), Dictionary->getRoute(NorthEast, SouthEast));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void RoutesAreShortenedByExitsAddedToRoomsOffTheRoute()
+{
+    object cellar = clone_object("/lib/tests/support/environment/testEnvironment.c");
+    NorthEast->testAddExit("down", object_name(cellar));
+    ExpectEq(({ "west", "south", "east" }),
+        Dictionary->getRoute(NorthEast, SouthEast));
+
+    cellar->testAddExit("east", object_name(SouthEast));
+    ExpectEq(({ "down", "east" }), Dictionary->getRoute(NorthEast, SouthEast));
+    destruct(cellar);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void RoutesThroughDestructedRoomsAreDropped()
+{
+    object cellar = clone_object("/lib/tests/support/environment/testEnvironment.c");
+    NorthEast->testAddExit("down", object_name(cellar));
+    cellar->testAddExit("east", object_name(SouthEast));
+    ExpectEq(({ "down", "east" }), Dictionary->getRoute(NorthEast, SouthEast));
+
+    string cellarName = object_name(cellar);
+    destruct(cellar);
+    Dictionary->reset(1);
+
+    ExpectEq(([]), Dictionary->exitsFrom(cellarName));
+    ExpectEq(({ "west", "south", "east" }),
+        Dictionary->getRoute(NorthEast, SouthEast));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void UnreachableRoutesAreFoundOnceExitsAreAdded()
+{
+    object island = clone_object("/lib/tests/support/environment/testEnvironment.c");
+    ExpectFalse(Dictionary->getRoute(SouthEast, island));
+
+    NorthEast->testAddExit("down", object_name(island));
+    ExpectEq(({ "west", "north", "east", "down" }),
+        Dictionary->getRoute(SouthEast, island));
+    destruct(island);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void NextStepReturnsFirstDirectionOfRoute()
+{
+    ExpectEq("west", Dictionary->nextStep(NorthEast, SouthEast));
+    ExpectFalse(Dictionary->nextStep(NorthEast, NorthEast));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void LandmarksCanBeRegisteredByEnvironments()
+{
+    SouthEast->testAddLandmark("the old mill");
+    ExpectEq(SouthEast,
+        find_object(Dictionary->landmarkLocation("the old mill")));
+}
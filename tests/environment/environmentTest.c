@@ -667,6 +667,139 @@ void ParseEfunCallForCallOtherWithKeyDisplaysInLong()
 
 }
 
+/////////////////////////////////////////////////////////////////////////////
+void LongReflectsTimeOfDayAndSeasonChangesAfterBeingCached()
+{
+    Environment->testSetTerrain("/lib/tests/support/environment/fakeTerrain.c");
+    Environment->testAddFeature("/lib/tests/support/environment/fakeFeature.c", "north");
+
+    Dictionary->timeOfDay("noon");
+    Dictionary->season("summer");
+    ExpectSubStringMatch("laden with acorns, noonishly glowing",
+        regreplace(Environment->long(), "\n", " ", 1));
+
+    Dictionary->timeOfDay("afternoon");
+    ExpectSubStringMatch("laden with acorns, afternooningly dreary",
+        regreplace(Environment->long(), "\n", " ", 1));
+
+    Dictionary->season("winter");
+    ExpectSubStringMatch("covered with a thick layer of snow, afternooningly dreary",
+        regreplace(Environment->long(), "\n", " ", 1));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void LongReflectsStateChangesAfterBeingCached()
+{
+    object stateMachine = load_object("/lib/core/stateMachine.c");
+    Environment->setStateMachine(stateMachine);
+    Environment->testSetTerrain("/lib/tests/support/environment/fakeTerrain.c");
+    Environment->testAddFeature("/lib/tests/support/environment/fakeFeature.c", "north");
+    Environment->testSetAdditionalLongDescription("This is an extra message", "blah");
+
+    ExpectFalse(sizeof(regexp(({ Environment->long() }), "extra message")));
+
+    Environment->onStateChanged(stateMachine, "blah");
+    ExpectSubStringMatch("This is an extra message",
+        regreplace(Environment->long(), "\n", " ", 1));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void EnvironmentalObjectIsReloadedWhenBlueprintIsDestructed()
+{
+    Environment->testSetTerrain("/lib/tests/support/environment/fakeTerrain.c");
+    Environment->testAddFeature("/lib/tests/support/environment/fakeFeature.c", "north");
+
+    object feature = Dictionary->environmentalObject("fake feature");
+    ExpectTrue(objectp(feature), "feature resolved");
+    ExpectEq(feature, Dictionary->environmentalObject("fake feature"));
+
+    destruct(feature);
+    feature = Dictionary->environmentalObject("fake feature");
+    ExpectTrue(objectp(feature), "feature reloaded");
+    ExpectEq("fake feature", feature->Name());
+    ExpectSubStringMatch("a stand of majestic oak trees",
+        regreplace(Environment->long(), "\n", " ", 1));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void CleanUpDoesNotSwapOutClones()
+{
+    ExpectTrue(Environment->clean_up(1));
+    ExpectTrue(objectp(Environment));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void CleanUpSwapsOutAndRestoresEnvironment()
+{
+    string room = "/lib/tests/support/environment/testEnvironment.c";
+    object environment = load_object(room);
+    environment->currentState("blah");
+
+    object sword = clone_object("/lib/instances/items/weapons/swords/long-sword.c");
+    sword->set("short", "Sword of Weasels");
+    move_object(sword, environment);
+
+    ExpectFalse(environment->clean_up(1));
+    ExpectFalse(find_object(room), "room swapped out");
+
+    environment = load_object(room);
+    ExpectEq("blah", environment->currentState());
+
+    sword = present_clone("/lib/instances/items/weapons/swords/long-sword.c",
+        environment);
+    ExpectTrue(objectp(sword), "sword restored");
+    ExpectEq("Sword of Weasels", sword->query("short"));
+    destruct(sword);
+    destruct(environment);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void CleanUpDoesNotSwapOutReferencedEnvironment()
+{
+    string room = "/lib/tests/support/environment/testEnvironment.c";
+    object environment = load_object(room);
+
+    ExpectTrue(environment->clean_up(2));
+    ExpectEq(environment, find_object(room));
+    destruct(environment);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void SwappedOutEnvironmentRestoresStateFromStateMachine()
+{
+    string room = "/lib/tests/support/environment/stateMachineEnvironment.c";
+    object stateMachine = load_object("/lib/tests/support/core/testStateMachine.c");
+    object environment = load_object(room);
+
+    stateMachine->testStartStateMachine();
+    ExpectEq("meet the king", environment->currentState());
+
+    ExpectFalse(environment->clean_up(1));
+    ExpectFalse(find_object(room), "room swapped out");
+
+    stateMachine->receiveEvent(this_object(), "meetTheKing");
+    environment = load_object(room);
+    ExpectEq("met the king", environment->currentState());
+
+    destruct(environment);
+    destruct(stateMachine);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void CleanUpDoesNotSwapOutEnvironmentWithLivings()
+{
+    string room = "/lib/tests/support/environment/testEnvironment.c";
+    object environment = load_object(room);
+
+    object monster = clone_object("/lib/realizations/monster.c");
+    move_object(monster, environment);
+
+    ExpectTrue(environment->clean_up(1));
+    ExpectEq(environment, find_object(room));
+    destruct(monster);
+    destruct(environment);
+}
+
 /////////////////////////////////////////////////////////////////////////////
 void InteriorsReturnFalseForIsIlluminatedByDefault()
 {
@@ -725,6 +858,18 @@ void InteriorsAffectedByLightSources()
     ExpectTrue(Environment->isIlluminated());
 }
 
+/////////////////////////////////////////////////////////////////////////////
+void IlluminationIsRecalculatedWhenLightSourceIsAdded()
+{
+    Environment->testSetInterior("/lib/tests/support/environment/fakeInterior.c");
+    Dictionary->timeOfDay("night");
+    Dictionary->season("spring");
+    ExpectFalse(Environment->isIlluminated());
+
+    Environment->testAddItem("/lib/tests/support/environment/fakeLightSource.c", "north");
+    ExpectTrue(Environment->isIlluminated());
+}
+
 /////////////////////////////////////////////////////////////////////////////
 void CanAddCustomLocations()
 {
@@ -768,3 +913,106 @@ void CannotAddUndefinedDefaultLocations()
     string error = catch (Environment->testAddFeature("/lib/tests/support/environment/fakeFeature.c", "turnip"));
     ExpectSubStringMatch("ERROR in environment.c.*turnip", error);
 }
+
+/////////////////////////////////////////////////////////////////////////////
+void FindInRoomReturnsMatchingContents()
+{
+    object person = clone_object("/lib/realizations/player.c");
+    person->Name("dwight");
+    move_object(person, Environment);
+    Environment->updateContentsIndex(person);
+
+    object weapon = clone_object("/lib/items/weapon.c");
+    weapon->set("name", "blah");
+    weapon->set("short", "Sword of Blah");
+    weapon->set("aliases", ({ "sword" }));
+    move_object(weapon, Environment);
+    Environment->updateContentsIndex(weapon);
+
+    object otherWeapon = clone_object("/lib/items/weapon.c");
+    otherWeapon->set("name", "bleh");
+    otherWeapon->set("aliases", ({ "sword" }));
+    move_object(otherWeapon, Environment);
+    Environment->updateContentsIndex(otherWeapon);
+
+    ExpectEq(person, Environment->findInRoom("dwight"));
+    ExpectEq(weapon, Environment->findInRoom("Sword of Blah"));
+    ExpectEq(otherWeapon, Environment->findInRoom("bleh"));
+    ExpectTrue(Environment->findInRoom("sword"));
+    ExpectTrue(Environment->findInRoom("sword 2"));
+    ExpectTrue(Environment->findInRoom("sword") != Environment->findInRoom("sword 2"));
+    ExpectEq(Environment->findInRoom("sword 2"), Environment->findInRoom("sword", 2));
+    ExpectFalse(Environment->findInRoom("sword 3"));
+    ExpectFalse(Environment->findInRoom("turnip"));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void FindInRoomReflectsAliasChanges()
+{
+    object weapon = clone_object("/lib/items/weapon.c");
+    weapon->set("name", "blah");
+    move_object(weapon, Environment);
+    Environment->updateContentsIndex(weapon);
+
+    ExpectEq(weapon, Environment->findInRoom("blah"));
+    weapon->set("name", "bork");
+    ExpectFalse(Environment->findInRoom("blah"));
+    ExpectEq(weapon, Environment->findInRoom("bork"));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void FindInRoomDoesNotReturnObjectsThatLeft()
+{
+    object person = clone_object("/lib/realizations/player.c");
+    person->Name("dwight");
+    move_object(person, Environment);
+    Environment->updateContentsIndex(person);
+
+    object weapon = clone_object("/lib/items/weapon.c");
+    weapon->set("name", "blah");
+    move_object(weapon, Environment);
+    Environment->updateContentsIndex(weapon);
+
+    ExpectEq(weapon, Environment->findInRoom("blah"));
+    move_object(weapon, person);
+    ExpectFalse(Environment->findInRoom("blah"));
+
+    destruct(person);
+    ExpectFalse(Environment->findInRoom("dwight"));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void FindInRoomReturnsItemsMovedWithoutNotification()
+{
+    object weapon = clone_object("/lib/items/weapon.c");
+    weapon->set("name", "blah");
+    weapon->set("aliases", ({ "sword" }));
+    move_object(weapon, Environment);
+    Environment->updateContentsIndex(weapon);
+
+    object otherWeapon = clone_object("/lib/items/weapon.c");
+    otherWeapon->set("name", "bleh");
+    otherWeapon->set("aliases", ({ "sword" }));
+    move_object(otherWeapon, Environment);
+
+    ExpectEq(otherWeapon, Environment->findInRoom("bleh"));
+    ExpectTrue(Environment->findInRoom("sword 2"));
+    ExpectFalse(Environment->findInRoom("sword 3"));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void FindInRoomReturnsDroppedItems()
+{
+    object person = clone_object("/lib/realizations/player.c");
+    person->Name("dwight");
+    move_object(person, Environment);
+
+    object weapon = clone_object("/lib/items/weapon.c");
+    weapon->set("name", "blah");
+    move_object(weapon, person);
+    ExpectFalse(Environment->findInRoom("blah"));
+
+    weapon->drop(1);
+    ExpectEq(weapon, Environment->findInRoom("blah"));
+    destruct(person);
+}
@@ -109,6 +109,20 @@ void MidnightDescriptionShowsCorrectTimeOfDayAndChangesForSeason()
     ExpectEq("a stand of oak trees outlined in eery black", Element->description());
 }
 
+/////////////////////////////////////////////////////////////////////////////
+void DescriptionReflectsDetailsAddedAfterItWasRendered()
+{
+    object light = clone_object("/lib/tests/support/environment/testLightSource.c");
+    ExpectEq("a light", light->description());
+
+    light->testAddSeasonDescription("summer", ({ " glowing brightly" }));
+    ExpectEq("a light glowing brightly", light->description());
+
+    Dictionary->timeOfDay("midnight");
+    ExpectEq("a light", light->description());
+    destruct(light);
+}
+
 /////////////////////////////////////////////////////////////////////////////
 void StateChangesUpdateDescription()
 {
@@ -274,3 +274,49 @@ void CanTranslateIncludedFiles()
         "}\n",
         oldRoom->generateNewRoom());
 }
+
+/////////////////////////////////////////////////////////////////////////////
+void ConvertDomainRaisesErrorForInvalidDomain()
+{
+    object converter = load_object("/lib/environment/legacyDomainConverter.c");
+    string err = catch (converter->convertDomain(
+        "/lib/tests/support/environment/blarg", "/lib/tests/support/converted"));
+
+    ExpectEq("*ERROR in legacyDomainConverter.c: '/lib/tests/support/environment/blarg' "
+        "is not a valid legacy domain or '/lib/tests/support/converted' is not a "
+        "valid destination.\n", err);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void ConvertDomainEmitsConvertedRoomsAndReport()
+{
+    object converter = load_object("/lib/environment/legacyDomainConverter.c");
+    string source = "/lib/tests/support/environment/legacy";
+    string destination = "/lib/tests/support/converted";
+
+    ExpectTrue(converter->convertDomain(source + "/", destination));
+    while (converter->processBatch(source));
+
+    mapping report = converter->conversionReport(source);
+    ExpectEq(0, report["pending"]);
+    ExpectTrue(member(report["converted"],
+        source + "/simpleLegacyUsingFunctions.c") > -1);
+    ExpectTrue(member(report["converted"],
+        source + "/complexWithIncludesAndOldPlayerMethods.c") > -1);
+    ExpectTrue(member(report["skipped"],
+        source + "/testLegacyEnvironment.c") > -1);
+
+    ExpectEq(load_object(source + "/simpleLegacyUsingVariables.c")->generateNewRoom(),
+        read_file(destination + "/simpleLegacyUsingVariables.c"));
+    ExpectSubStringMatch("Converted: " + sizeof(report["converted"]),
+        read_file(destination + "/conversionReport.txt"));
+
+    foreach(string file in get_dir(destination + "/*", 0x01))
+    {
+        if ((file != ".") && (file != ".."))
+        {
+            rm(destination + "/" + file);
+        }
+    }
+    rmdir(destination);
+}
@@ -0,0 +1,115 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+inherit "/lib/tests/framework/testFixture.c";
+
+object Region;
+object Dictionary;
+object Environment;
+
+/////////////////////////////////////////////////////////////////////////////
+void Setup()
+{
+    Dictionary = load_object("/lib/dictionaries/environmentDictionary.c");
+    Region = load_object("/lib/tests/support/environment/testRegion.c");
+    Environment = load_object("/lib/tests/support/environment/testEnvironment.c");
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void CleanUp()
+{
+    destruct(Environment);
+    destruct(Region);
+    destruct(Dictionary);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void GetRegionReturnsRegionObject()
+{
+    ExpectEq(Region, Dictionary->getRegion("/lib/tests/support/environment/testRegion.c"));
+    ExpectEq(Region, Dictionary->getRegion("lib/tests/support/environment/testRegion.c"));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void GetRegionReturnsZeroForNonRegions()
+{
+    ExpectFalse(Dictionary->getRegion("/lib/tests/support/environment/toLocation.c"));
+    ExpectFalse(Dictionary->getRegion("/lib/tests/support/environment/blarg.c"));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void CoordinatesValidForRegionChecksDimensions()
+{
+    ExpectTrue(Dictionary->coordinatesValidForRegion("/lib/tests/support/environment/testRegion.c", 0, 0));
+    ExpectTrue(Dictionary->coordinatesValidForRegion("/lib/tests/support/environment/testRegion.c", 39, 39));
+    ExpectFalse(Dictionary->coordinatesValidForRegion("/lib/tests/support/environment/testRegion.c", 40, 0));
+    ExpectFalse(Dictionary->coordinatesValidForRegion("/lib/tests/support/environment/testRegion.c", 0, -1));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void RoomsAreIndexedByCoordinate()
+{
+    ExpectEq("/lib/tests/support/environment/toLocation.c", Region->roomAt(15, 15));
+    ExpectEq("/lib/tests/support/environment/fromLocation.c", Region->roomAt(16, 15));
+    ExpectFalse(Region->roomAt(1, 1));
+    ExpectEq(({ 15, 16 }), Region->coordinatesOf("/lib/tests/support/environment/fakeEnvironment.c"));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void OverheadMapDoesNotLoadRooms()
+{
+    object room = find_object("/lib/tests/support/environment/fromLocation.c");
+    if (room)
+    {
+        destruct(room);
+    }
+
+    ExpectEq("   \n @~\n . \n", Region->getRelativeOverheadMap(15, 15, 1));
+    ExpectFalse(find_object("/lib/tests/support/environment/fromLocation.c"));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void OverheadMapIsPaddedAtRegionEdges()
+{
+    ExpectEq("   \n @ \n   \n", Region->getRelativeOverheadMap(0, 0, 1));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void OverheadMapReturnsZeroForInvalidCoordinates()
+{
+    ExpectFalse(Region->getRelativeOverheadMap(50, 50));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void SetCoordinatesRegistersEnvironmentWithRegion()
+{
+    Environment->testSetCoordinates("/lib/tests/support/environment/testRegion.c", 14, 15);
+
+    ExpectEq(({ 14, 15 }), Region->coordinatesOf(program_name(Environment)));
+    ExpectEq("   \n @#\n  .\n", Region->getRelativeOverheadMap(14, 15, 1));
+    ExpectSubStringMatch("@#~", Environment->overheadMap());
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void ClonesDoNotReplaceTheirBlueprintOnTheRegion()
+{
+    Environment->testSetCoordinates("/lib/tests/support/environment/testRegion.c", 14, 15);
+
+    object clone = clone_object("/lib/tests/support/environment/testEnvironment.c");
+    clone->testSetCoordinates("/lib/tests/support/environment/testRegion.c", 14, 15);
+
+    ExpectEq("/lib/tests/support/environment/testEnvironment.c", Region->roomAt(14, 15));
+    ExpectFalse(Region->coordinatesOf(object_name(clone)));
+    ExpectSubStringMatch("@#~", clone->overheadMap());
+    destruct(clone);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void SetCoordinatesRaisesErrorForInvalidCoordinates()
+{
+    string err = catch (Environment->testSetCoordinates(
+        "/lib/tests/support/environment/testRegion.c", 41, 15));
+    ExpectEq("*ERROR in environment.c: coordinates(41,15) are not valid "
+        "for this region: '/lib/tests/support/environment/testRegion.c'.\n", err);
+}
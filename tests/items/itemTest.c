@@ -773,3 +773,54 @@ void CraftingMaterialsAreDisplayedInLongDescription()
         "resemble a dragon's talon. Clutched in its grip is a beautifully cut ruby.",
         Item->long());
 }
+
+/////////////////////////////////////////////////////////////////////////////
+void DeltaOnlyContainsDataThatDiffersFromBlueprint()
+{
+    object sword = 
+        clone_object("/lib/instances/items/weapons/swords/long-sword.c");
+    sword->set("material", "galvorn");
+    sword->set("craftsmanship", 20);
+
+    mapping delta = restore_value(sword->query("delta"));
+    ExpectEq(1, delta["serialization version"]);
+    ExpectEq(([ "material": "galvorn", "craftsmanship": 20 ]), delta["set"]);
+    ExpectEq(({ }), delta["unset"]);
+    destruct(sword);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void DeltaRestoresItemFromBlueprint()
+{
+    object sword = 
+        clone_object("/lib/instances/items/weapons/swords/long-sword.c");
+    sword->set("material", "galvorn");
+    sword->set("enchantments", (["fire": 5]));
+    sword->unset("aliases");
+    string delta = sword->query("delta");
+
+    object restoredSword = 
+        clone_object("/lib/instances/items/weapons/swords/long-sword.c");
+    ExpectTrue(restoredSword->set("delta", delta));
+
+    ExpectEq(restore_value(sword->query("all")), 
+        restore_value(restoredSword->query("all")));
+    ExpectEq("Long sword", restoredSword->query("name"));
+    ExpectFalse(restoredSword->query("aliases"));
+    destruct(sword);
+    destruct(restoredSword);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void DeltaCanRestoreLegacyFullItemData()
+{
+    object sword = 
+        clone_object("/lib/instances/items/weapons/swords/long-sword.c");
+    sword->set("material", "galvorn");
+    sword->set("craftsmanship", 20);
+
+    ExpectTrue(Item->set("delta", sword->query("all")));
+    ExpectEq(restore_value(sword->query("all")), 
+        restore_value(Item->query("all")));
+    destruct(sword);
+}
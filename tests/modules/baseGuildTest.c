@@ -263,6 +263,29 @@ void ModifierCriteriaWithMultipleCriteriaIsCumulative()
     ExpectEq(125, Guild->queryBonus("bonus hit points", 19, ""));
 }
 
+/////////////////////////////////////////////////////////////////////////////
+void BonusesReflectCriteriaAddedAfterBonusWasQueried()
+{
+    ExpectTrue(Guild->testAddCriteria("hit points", ([
+        "type":"modifier",
+        "apply" : "5 every level",
+        "end at level": 10
+    ])));
+    ExpectEq(10, Guild->queryBonus("bonus hit points", 2, ""));
+    ExpectEq(0, Guild->queryBonus("bonus spell points", 2, ""));
+
+    ExpectTrue(Guild->testAddCriteria("spell points", ([
+        "type":"modifier",
+        "apply" : "2 every level",
+        "begin at level": 1,
+        "begin at rank": "grand master squid"
+    ])));
+    ExpectEq(10, Guild->queryBonus("bonus hit points", 2, "grand master squid"));
+    ExpectEq(0, Guild->queryBonus("bonus spell points", 2, "default"));
+    ExpectEq(4, Guild->queryBonus("bonus spell points", 2, "grand master squid"));
+    ExpectEq(50, Guild->queryBonus("bonus hit points", 25, ""));
+}
+
 /////////////////////////////////////////////////////////////////////////////
 void SkillCriteriaWithXEveryLevelIsCorrectlyApplied()
 {
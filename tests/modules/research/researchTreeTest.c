@@ -274,3 +274,20 @@ void GetFlattenedResearchTreeForOwnerReturnsFlatListWithDetails()
     ExpectEq(expected, tree->getFlattenedResearchTree(owner), "tree with data");
 }
 
+
+/////////////////////////////////////////////////////////////////////////////
+void GetFlattenedResearchTreeReflectsResearchDoneAfterTreeWasViewed()
+{
+    object owner = clone_object("/lib/realizations/player.c");
+    owner->Name("Fred");
+    ExpectTrue(owner->addResearchTree("lib/tests/support/research/testDeepResearchTree.c"));
+
+    object tree = load_object("/lib/dictionaries/researchDictionary.c")->
+        researchTree("lib/tests/support/research/testDeepResearchTree.c");
+    object researchB = load_object("/lib/tests/support/research/testResearchB.c");
+
+    ExpectEq((["can research":1]), tree->getFlattenedResearchTree(owner)[researchB], "B can be researched");
+
+    ExpectTrue(owner->initiateResearch("lib/tests/support/research/testResearchB.c"));
+    ExpectEq((["researching":1]), tree->getFlattenedResearchTree(owner)[researchB], "B is being researched");
+}
@@ -758,3 +758,17 @@ void ResearchSustainedCommandReducesByCost()
     ExpectTrue(Research->sustainedResearchIsActive("lib/tests/support/research/testSustainedTraitResearch.c"), "research is active");
     ExpectTrue(target->isTraitOf("lib/tests/support/traits/testTraitForSustainedResearch.c"), "trait is active");
 }
+
+/////////////////////////////////////////////////////////////////////////////
+void ResearchBonusSourcesTracksEachResearchItem()
+{
+    ExpectEq(([]), Research->researchBonusSources("long sword"), "no sources before research");
+    ExpectTrue(Research->initiateResearch("lib/tests/support/research/testGrantedResearchItem.c"), "initiate first research");
+    ExpectEq(5, Research->researchBonusTo("long sword"), "bonus after first research");
+
+    ExpectTrue(Research->initiateResearch("lib/tests/support/research/secondGrantedResearchItem.c"), "initiate second research");
+    ExpectEq(([ "lib/tests/support/research/testGrantedResearchItem.c": 5,
+        "lib/tests/support/research/secondGrantedResearchItem.c": 5 ]),
+        Research->researchBonusSources("long sword"), "sources after second research");
+    ExpectEq(10, Research->researchBonusTo("long sword"), "bonus after second research");
+}
@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+
+// Compares save and restore latency across the available data access
+// backends. This is not a test fixture - it is run by hand, ie:
+//   call /lib/tests/modules/secure/dataServices/backends/backendBenchmark.c
+//       executeBenchmark 25
+private nosave int DefaultIterations = 25;
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int elapsedMicroseconds(int *start, int *end)
+{
+    return (end[0] - start[0]) * 1000000 + (end[1] - start[1]);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask mapping benchmarkBackend(string backend, int iterations)
+{
+    object registry = load_object(
+        "/lib/modules/secure/dataServices/backends/backendRegistry.c");
+    object database = clone_object("/lib/tests/modules/secure/fakeDatabase.c");
+    object dataAccess = clone_object("/lib/modules/secure/dataAccess.c");
+
+    registry->useBackend(backend);
+    database->PrepDatabase();
+
+    mapping playerData = database->Gorthaur();
+    mapping ret = ([ "backend": backend, "iterations": iterations ]);
+
+    int *start = utime();
+    int evalCost = get_eval_cost();
+    for (int i = 0; i < iterations; i++)
+    {
+        dataAccess->savePlayerData(playerData);
+    }
+    ret["save eval cost"] = (evalCost - get_eval_cost()) / iterations;
+    ret["save microseconds"] =
+        elapsedMicroseconds(start, utime()) / iterations;
+
+    start = utime();
+    evalCost = get_eval_cost();
+    for (int i = 0; i < iterations; i++)
+    {
+        dataAccess->getPlayerData(playerData["name"]);
+    }
+    ret["restore eval cost"] = (evalCost - get_eval_cost()) / iterations;
+    ret["restore microseconds"] =
+        elapsedMicroseconds(start, utime()) / iterations;
+
+    destruct(dataAccess);
+    destruct(database);
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask varargs mapping *executeBenchmark(int iterations)
+{
+    object registry = load_object(
+        "/lib/modules/secure/dataServices/backends/backendRegistry.c");
+    string originalBackend = registry->activeBackendName();
+
+    if (iterations <= 0)
+    {
+        iterations = DefaultIterations;
+    }
+
+    mapping *ret = ({});
+    foreach(string backend in registry->availableBackends())
+    {
+        // Asynchronous backends cannot serve the synchronous data access
+        // calls timed here, so they are reported and skipped.
+        mapping result;
+        string error = catch (result =
+            benchmarkBackend(backend, iterations); nolog);
+
+        if (error)
+        {
+            debug_message(sprintf("%-10s skipped: %s", backend, error), 0x5);
+            continue;
+        }
+        ret += ({ result });
+
+        debug_message(sprintf("%-10s save: %8d us %8d evals   "
+            "restore: %8d us %8d evals\n", backend,
+            result["save microseconds"], result["save eval cost"],
+            result["restore microseconds"], result["restore eval cost"]), 0x5);
+    }
+
+    registry->useBackend(originalBackend);
+    return ret;
+}
@@ -0,0 +1,103 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+inherit "/lib/tests/framework/testFixture.c";
+
+object Backend;
+mixed Result;
+int Completed;
+
+/////////////////////////////////////////////////////////////////////////////
+void Setup()
+{
+    Backend = clone_object("/lib/tests/support/services/testPostgresBackend.c");
+    Result = 0;
+    Completed = 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void CleanUp()
+{
+    destruct(Backend);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private mixed readWriteAndReadAgain(string name)
+{
+    int handle = Backend->connect();
+
+    Backend->executeQuery(handle, "select level from players");
+    mixed before = Backend->fetchResult(handle);
+
+    Backend->callProcedure(handle, "raiseLevel", ({ name }));
+
+    Backend->executeQuery(handle, "select level from players");
+    mixed after = Backend->fetchResult(handle);
+
+    Backend->disconnect(handle);
+    return ({ before, after });
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private void operationCompleted(mixed result, string name)
+{
+    Result = result;
+    Completed++;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void NoWritesAreSentWhileWaitingOnAResult()
+{
+    Backend->runOperation(#'readWriteAndReadAgain, ({ "gorthaur" }),
+        #'operationCompleted);
+
+    ExpectEq(({ "select level from players" }), Backend->testSentQueries());
+    ExpectFalse(Completed);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void WritesAreSentOnceAcrossReplays()
+{
+    Backend->runOperation(#'readWriteAndReadAgain, ({ "gorthaur" }),
+        #'operationCompleted);
+    Backend->testReturnRows(1, ({ ({ 5 }) }));
+
+    ExpectEq(({ "select level from players",
+        "select raiseLevel('gorthaur');",
+        "select level from players" }), Backend->testSentQueries());
+
+    Backend->testReturnRows(2, ({ ({ 0 }) }));
+    Backend->testReturnRows(3, ({ ({ 6 }) }));
+
+    ExpectEq(3, sizeof(Backend->testSentQueries()));
+    ExpectEq(1, Completed);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void ReadsAfterAWriteAreNotAnsweredFromEarlierResults()
+{
+    Backend->runOperation(#'readWriteAndReadAgain, ({ "gorthaur" }),
+        #'operationCompleted);
+    Backend->testReturnRows(1, ({ ({ 5 }) }));
+    Backend->testReturnRows(2, ({ ({ 0 }) }));
+    Backend->testReturnRows(3, ({ ({ 6 }) }));
+
+    ExpectEq(({ ({ 5 }), ({ 6 }) }), Result);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void FailedQueryHandsErrorToCallback()
+{
+    Backend->runOperation(#'readWriteAndReadAgain, ({ "gorthaur" }),
+        #'operationCompleted);
+    Backend->testFailQuery(1, "relation \"players\" does not exist");
+
+    ExpectEq(([ "database error": "relation \"players\" does not exist" ]),
+        Result);
+    ExpectEq(1, Completed);
+
+    Backend->testReturnRows(1, ({ ({ 5 }) }));
+    ExpectEq(({ "select level from players" }), Backend->testSentQueries());
+    ExpectEq(1, Completed);
+}
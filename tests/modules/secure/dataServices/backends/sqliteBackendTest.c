@@ -0,0 +1,182 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+inherit "/lib/tests/framework/testFixture.c";
+
+object DataAccess;
+object Database;
+object Registry;
+
+/////////////////////////////////////////////////////////////////////////////
+void Init()
+{
+    setRestoreCaller(this_object());
+    Registry = load_object(
+        "/lib/modules/secure/dataServices/backends/backendRegistry.c");
+    Database = clone_object("/lib/tests/modules/secure/fakeDatabase.c");
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void Setup()
+{
+    Registry->useBackend("sqlite");
+    Database->PrepDatabase();
+    DataAccess = clone_object("/lib/modules/secure/dataAccess.c");
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void CleanUp()
+{
+    destruct(DataAccess);
+    Registry->useBackend("mysql");
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void ActiveBackendIsSqlite()
+{
+    ExpectEq("sqlite", Registry->activeBackendName());
+    ExpectEq("/lib/modules/secure/dataServices/backends/sqliteBackend.c",
+        program_name(Registry->activeBackend()));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void UseBackendFailsForUnknownBackend()
+{
+    ExpectFalse(Registry->useBackend("oracle"));
+    ExpectEq("sqlite", Registry->activeBackendName());
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void PlayerTypeReturnsCorrectWizardValueFromDatabase()
+{
+    ExpectEq("owner", DataAccess->playerType("maeglin"));
+    ExpectEq("player", DataAccess->playerType("gorthaur"));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void GetPlayerDataReturnsDataFromDatabase()
+{
+    mapping expected = Database->Gorthaur();
+
+    DataAccess->savePlayerData(expected);
+    mapping result = DataAccess->getPlayerData("gorthaur");
+
+    ExpectTrue(member(result, "whenCreated"));
+    m_delete(result, "whenCreated");
+
+    ExpectEq(expected, result);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void GetPlayerDataForWizardReturnsDataFromDatabase()
+{
+    mapping expected = Database->GetWizardOfLevel("creator");
+
+    DataAccess->savePlayerData(expected);
+    mapping result = DataAccess->getPlayerData("earl");
+
+    ExpectTrue(member(result, "whenCreated"));
+    m_delete(result, "whenCreated");
+
+    ExpectEq(expected, result);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void CanSaveDataMultipleTimes()
+{
+    DataAccess->savePlayerData(Database->Gorthaur());
+    mapping result = DataAccess->getPlayerData("gorthaur");
+    ExpectEq(100, result["hitPoints"]);
+
+    result["hitPoints"] = 120;
+    DataAccess->savePlayerData(result);
+
+    result = DataAccess->getPlayerData("gorthaur");
+    ExpectEq(120, result["hitPoints"]);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void CombatStatisticsTrackNemesisAndBestKill()
+{
+    DataAccess->savePlayerData(Database->Gorthaur());
+
+    DataAccess->saveCombatStatistics("gorthaur",
+        "lib/realizations/monster.c#bob", "bob", 10, 3);
+    DataAccess->saveCombatStatistics("gorthaur",
+        "lib/realizations/monster.c#fred", "fred", 12);
+
+    ExpectEq(([ "name": "bob",
+                "level": 10,
+                "key": "lib/realizations/monster.c#bob",
+                "times killed": 3 ]),
+        DataAccess->getNemesis("gorthaur"));
+
+    ExpectEq(([ "name": "fred",
+                "level": 12,
+                "key": "lib/realizations/monster.c#fred",
+                "times killed": 1 ]),
+        DataAccess->getBestKill("gorthaur"));
+
+    ExpectTrue(DataAccess->bestKillMeetsLevel("gorthaur", 12));
+    ExpectFalse(DataAccess->bestKillMeetsLevel("gorthaur", 13));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void RacialKillsMeetCountCorrectlyReturns()
+{
+    DataAccess->savePlayerData(Database->Gorthaur());
+
+    ExpectFalse(DataAccess->racialKillsMeetCount("gorthaur", "orc", 2));
+    DataAccess->saveCombatStatisticsForRace("gorthaur", "orc");
+
+    ExpectFalse(DataAccess->racialKillsMeetCount("gorthaur", "orc", 2));
+    DataAccess->saveCombatStatisticsForRace("gorthaur", "orc");
+
+    ExpectTrue(DataAccess->racialKillsMeetCount("gorthaur", "orc", 2));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void OpinionsAndCharacterStatesArePersisted()
+{
+    DataAccess->savePlayerData(Database->Gorthaur());
+
+    DataAccess->setOpinionOfCharacter("gorthaur",
+        "lib/realizations/monster.c#fred", 6);
+    DataAccess->setCharacterState("gorthaur",
+        "lib/realizations/monster.c#fred", "first state");
+
+    ExpectEq(6, DataAccess->getOpinionOfCharacter("gorthaur",
+        "lib/realizations/monster.c#fred"));
+    ExpectEq("first state", DataAccess->getCharacterState("gorthaur",
+        "lib/realizations/monster.c#fred"));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void FailedSessionIsRolledBackWithoutBlockingLaterSessions()
+{
+    object backend = Registry->activeBackend();
+    DataAccess->savePlayerData(Database->Gorthaur());
+
+    int handle = backend->connect();
+    backend->callProcedure(handle, "saveCharacterState", ({ "gorthaur",
+        "lib/realizations/monster.c#fred", "lost state" }));
+
+    string err = catch (backend->callProcedure(handle, "blarg", ({})));
+    ExpectSubStringMatch("Unknown procedure 'blarg'", err);
+
+    ExpectFalse(DataAccess->getCharacterState("gorthaur",
+        "lib/realizations/monster.c#fred"));
+
+    DataAccess->setCharacterState("gorthaur",
+        "lib/realizations/monster.c#fred", "kept state");
+    ExpectEq("kept state", DataAccess->getCharacterState("gorthaur",
+        "lib/realizations/monster.c#fred"));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void SanitizeStringEscapesQuotes()
+{
+    ExpectEq("Sauron''s ring",
+        Registry->activeBackend()->sanitizeString("Sauron's ring"));
+}
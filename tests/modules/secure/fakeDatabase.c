@@ -156,19 +156,28 @@ public nomask mapping Gorthaur()
 /////////////////////////////////////////////////////////////////////////////
 public nomask void PrepDatabase()
 {
-    string dbScript = read_file("/lib/tests/modules/secure/generateDB.sql");
+    object registry = load_object(
+        "/lib/modules/secure/dataServices/backends/backendRegistry.c");
+
+    string dbScript = read_file(([
+        "mysql": "/lib/tests/modules/secure/generateDB.sql",
+        "postgres": "/lib/tests/modules/secure/generatePostgresDB.sql",
+        "sqlite": "/lib/tests/modules/secure/generateSqliteDB.sql"
+    ])[registry->activeBackendName()]);
 
     string *commands = explode(dbScript, "##");
 
-    int dbHandle = db_connect(RealmsDatabase());
-    db_exec(dbHandle, "use " + RealmsDatabase() + ";");
+    object backend = registry->activeBackend();
+    int dbHandle = backend->connect();
 
     foreach(string command in commands)
     {
-        db_exec(dbHandle, command);
+        if (sizeof(trim(command)))
+        {
+            backend->executeQuery(dbHandle, command);
+        }
     }
-    while (db_fetch(dbHandle));
-    db_close(dbHandle);
+    backend->disconnect(dbHandle);
 }
 
 /////////////////////////////////////////////////////////////////////////////
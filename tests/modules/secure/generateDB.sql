@@ -764,7 +764,7 @@ BEGIN
 END;
 ##
 CREATE PROCEDURE `saveCombatStatistics` (p_playerName varchar(40),
-p_key varchar(200), p_name varchar(40), p_level int)
+p_key varchar(200), p_name varchar(40), p_level int, p_timesKilled int)
 BEGIN	
 	declare lPlayerId int;
     declare statId int;
@@ -781,12 +781,12 @@ BEGIN
 		
         if(statId is not null) then
 			update combatStatistics
-			set timesKilled = timesPreviouslyKilled + 1
+			set timesKilled = timesPreviouslyKilled + p_timesKilled
             where id = statId;
 		else
             insert into combatStatistics
             (name, level, foeKey, timesKilled, playerId)
-            values (p_name, p_level, p_key, 1, lPlayerId);           
+            values (p_name, p_level, p_key, p_timesKilled, lPlayerId);           
         end if;
         
         update combatStatistics
@@ -818,7 +818,7 @@ BEGIN
 END;
 ##
 CREATE PROCEDURE `saveCombatStatisticsForRace` 
-(p_playerName varchar(40), p_race varchar(20))
+(p_playerName varchar(40), p_race varchar(20), p_timesKilled int)
 BEGIN	
 	declare lPlayerId int;
     declare statId int;
@@ -833,12 +833,12 @@ BEGIN
 		
         if(statId is not null) then
 			update combatStatisticsForRace
-			set timesKilled = timesKilled + 1
+			set timesKilled = timesKilled + p_timesKilled
             where id = statId;
 		else
             insert into combatStatisticsForRace
             (playerid, race, timesKilled)
-            values (lPlayerId, p_race, 1);           
+            values (lPlayerId, p_race, p_timesKilled);           
         end if;
     end if;
 END;
@@ -0,0 +1,802 @@
+create extension if not exists citext;
+##
+drop function if exists saveBasicPlayerInformation cascade;
+##
+drop function if exists saveBiologicalInformation cascade;
+##
+drop function if exists saveCombatInformation cascade;
+##
+drop function if exists saveMaterialAttribute cascade;
+##
+drop function if exists saveMaterialAttributes cascade;
+##
+drop function if exists saveGuild cascade;
+##
+drop function if exists saveQuest cascade;
+##
+drop function if exists saveResearch cascade;
+##
+drop function if exists pruneResearchChoices cascade;
+##
+drop function if exists saveResearchChoice cascade;
+##
+drop function if exists saveResearchChoiceOption cascade;
+##
+drop function if exists saveOpenResearchTrees cascade;
+##
+drop function if exists saveSkills cascade;
+##
+drop function if exists saveTraits cascade;
+##
+drop function if exists saveTemporaryTraits cascade;
+##
+drop function if exists pruneInventory cascade;
+##
+drop function if exists saveInventoryItem cascade;
+##
+drop function if exists saveFaction cascade;
+##
+drop function if exists saveCombatStatistics cascade;
+##
+drop function if exists saveCombatStatisticsForRace cascade;
+##
+drop function if exists saveWizardLevel cascade;
+##
+drop function if exists saveOpinionOfCharacter cascade;
+##
+drop function if exists saveCharacterState cascade;
+##
+drop view if exists basicPlayerData;
+##
+drop view if exists researchChoicesView;
+##
+drop view if exists traitsView;
+##
+drop table if exists characterStates cascade;
+##
+drop table if exists opinions cascade;
+##
+drop table if exists inventory cascade;
+##
+drop table if exists factions cascade;
+##
+drop table if exists timedtraits cascade;
+##
+drop table if exists traits cascade;
+##
+drop table if exists temporaryTraits cascade;
+##
+drop table if exists skills cascade;
+##
+drop table if exists wizards cascade;
+##
+drop table if exists wizardTypes cascade;
+##
+drop table if exists researchChoiceItems cascade;
+##
+drop table if exists researchChoices cascade;
+##
+drop table if exists research cascade;
+##
+drop table if exists quests cascade;
+##
+drop table if exists playerCombatData cascade;
+##
+drop table if exists openResearchTrees cascade;
+##
+drop table if exists materialAttributes cascade;
+##
+drop table if exists guilds cascade;
+##
+drop table if exists combatStatisticsForRace cascade;
+##
+drop table if exists combatStatistics cascade;
+##
+drop table if exists biological cascade;
+##
+drop table if exists players cascade;
+##
+create table players (
+  id serial primary key,
+  name citext not null unique,
+  race citext not null,
+  age bigint not null,
+  gender bigint not null default 0,
+  ghost bigint not null default 0,
+  strength bigint not null default 0,
+  intelligence bigint not null default 0,
+  dexterity bigint not null default 0,
+  wisdom bigint not null default 0,
+  constitution bigint not null default 0,
+  charisma bigint not null default 0,
+  invisible bigint not null default 0,
+  whenCreated timestamp not null default now(),
+  location citext not null,
+  attributePoints bigint not null default 0,
+  skillPoints bigint not null default 0,
+  researchPoints bigint not null default 0,
+  unassignedExperience bigint default null,
+  playerMoney bigint default null
+);
+##
+create table biological (
+  id serial primary key,
+  playerid bigint not null,
+  intoxicated bigint not null default 0,
+  stuffed bigint not null default 0,
+  drugged bigint not null default 0,
+  soaked bigint not null default 0,
+  headache bigint not null default 0,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table combatStatistics (
+  id serial primary key,
+  name citext not null,
+  level bigint not null,
+  foeKey citext default null,
+  timesKilled bigint default null,
+  playerid bigint not null,
+  isNemesis bigint not null default 0,
+  isBestKill bigint not null default 0,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table combatStatisticsForRace (
+  id serial primary key,
+  playerid bigint not null,
+  race citext not null,
+  timesKilled bigint not null,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table guilds (
+  id serial primary key,
+  playerid bigint not null,
+  name citext not null,
+  level bigint not null default 0,
+  experience bigint not null default 0,
+  rank citext default null,
+  title citext default null,
+  pretitle citext default null,
+  leftGuild bigint default null,
+  anathema bigint default null,
+  rankAdvancedAt bigint default null,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table materialAttributes (
+  id serial primary key,
+  playerid bigint not null,
+  type citext not null,
+  value citext not null,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table openResearchTrees (
+  id serial primary key,
+  playerid bigint not null,
+  researchTree citext not null,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table playerCombatData (
+  id serial primary key,
+  playerid bigint not null,
+  hitPoints bigint not null,
+  maxHitPoints bigint not null,
+  spellPoints bigint not null,
+  maxSpellPoints bigint not null,
+  staminaPoints bigint not null,
+  maxStaminaPoints bigint not null,
+  wimpy bigint not null default 0,
+  onKillList bigint not null default 0,
+  timeToHealHP bigint not null default 0,
+  timeToHealSP bigint not null default 0,
+  timeToHealST bigint not null default 0,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table quests (
+  id serial primary key,
+  playerid bigint not null,
+  path citext not null,
+  name citext not null,
+  state citext not null,
+  statesCompleted citext default null,
+  isActive bigint not null default 0,
+  isCompleted bigint not null default 0,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table research (
+  id serial primary key,
+  playerId bigint not null,
+  path citext not null,
+  whenResearchBegan bigint not null default 0,
+  whenResearchComplete bigint default null,
+  timeSpentLearning bigint default null,
+  researchComplete bigint not null default 0,
+  timeToCompleteLearning bigint default null,
+  cooldown bigint default null,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table researchChoices (
+  id serial primary key,
+  playerId bigint not null,
+  name citext not null,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table researchChoiceItems (
+  id serial primary key,
+  researchChoiceId bigint not null,
+  selectionNumber citext not null,
+  type citext not null,
+  name citext not null,
+  description citext not null,
+  key citext not null
+);
+##
+create table wizardTypes (
+  id serial primary key,
+  type citext not null
+);
+##
+create table wizards (
+  id serial primary key,
+  playerId bigint not null,
+  typeId bigint not null
+);
+##
+create table skills (
+  id serial primary key,
+  playerid bigint not null,
+  name citext not null,
+  value bigint not null,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table temporaryTraits (
+  id serial primary key,
+  playerid bigint not null,
+  traitList citext not null,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table traits (
+  id serial primary key,
+  playerid bigint not null,
+  path citext not null,
+  name citext not null,
+  added bigint not null,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table timedtraits (
+  id serial primary key,
+  traitid bigint not null,
+  endTime bigint not null,
+  expireMessage citext default null,
+  triggeringResearch citext default null,
+  FOREIGN KEY (traitid) REFERENCES traits (id)
+);
+##
+create table factions (
+  id serial primary key,
+  playerid bigint not null,
+  path citext not null,
+  disposition citext not null,
+  reputation bigint not null,
+  lastInteraction bigint not null,
+  lastReputation bigint not null,
+  numberOfInteractions bigint not null,
+  dispositionTime bigint not null,
+  isMember bigint not null default 0,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table inventory (
+  playerid bigint not null,
+  fileName citext not null,
+  data text not null,
+  isEquipped bigint not null default 0,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table opinions (
+  id serial primary key,
+  playerId bigint not null,
+  targetKey citext not null,
+  opinion bigint not null default 0,
+  lastInteraction bigint default null
+);
+##
+create table characterStates (
+  id serial primary key,
+  playerId bigint not null,
+  targetKey citext not null,
+  state citext not null
+);
+##
+create index biological_playerid_idx on biological (playerid);
+##
+create index combatStatistics_playerid_idx on combatStatistics (playerid, foeKey);
+##
+create index combatStatisticsForRace_playerid_idx on combatStatisticsForRace (playerid, race);
+##
+create index guilds_playerid_idx on guilds (playerid, name);
+##
+create index materialAttributes_playerid_idx on materialAttributes (playerid, type);
+##
+create index openResearchTrees_playerid_idx on openResearchTrees (playerid);
+##
+create index playerCombatData_playerid_idx on playerCombatData (playerid);
+##
+create index quests_playerid_idx on quests (playerid, path);
+##
+create index research_playerId_idx on research (playerId, path);
+##
+create index researchChoices_playerId_idx on researchChoices (playerId);
+##
+create index researchChoiceItems_researchChoiceId_idx on researchChoiceItems (researchChoiceId);
+##
+create index wizards_playerId_idx on wizards (playerId);
+##
+create index skills_playerid_idx on skills (playerid, name);
+##
+create index temporaryTraits_playerid_idx on temporaryTraits (playerid);
+##
+create index traits_playerid_idx on traits (playerid, path);
+##
+create index timedtraits_traitid_idx on timedtraits (traitid);
+##
+create index factions_playerid_idx on factions (playerid, path);
+##
+create index inventory_playerid_idx on inventory (playerid);
+##
+create index opinions_playerId_idx on opinions (playerId, targetKey);
+##
+create index characterStates_playerId_idx on characterStates (playerId, targetKey);
+##
+create view basicPlayerData as select players.name as name,players.race as race,players.age as age,players.gender as gender,players.ghost as ghost,players.strength as strength,players.intelligence as intelligence,players.dexterity as dexterity,players.wisdom as wisdom,players.constitution as constitution,players.charisma as charisma,players.invisible as invisible,biological.intoxicated as intoxicated,biological.stuffed as stuffed,biological.drugged as drugged,biological.soaked as soaked,biological.headache as headache,playerCombatData.hitPoints as hitPoints,playerCombatData.maxHitPoints as maxHitPoints,playerCombatData.spellPoints as spellPoints,playerCombatData.maxSpellPoints as maxSpellPoints,playerCombatData.staminaPoints as staminaPoints,playerCombatData.maxStaminaPoints as maxStaminaPoints,playerCombatData.wimpy as wimpy,playerCombatData.onKillList as onKillList,playerCombatData.timeToHealHP as timeToHealHP,playerCombatData.timeToHealSP as timeToHealSP,playerCombatData.timeToHealST as timeToHealST,players.whenCreated as whenCreated,players.location as location,players.attributePoints as availableAttributePoints,players.skillPoints as availableSkillPoints,players.researchPoints as availableResearchPoints,players.unassignedExperience as unassignedExperience,players.playerMoney as playerMoney,players.id as playerId from ((players join biological on((players.id = biological.playerid))) join playerCombatData on((players.id = playerCombatData.playerid)));
+##
+create view researchChoicesView as select researchChoices.playerId as playerId,researchChoices.name as Choice,researchChoiceItems.selectionNumber as selectionNumber,researchChoiceItems.type as type,researchChoiceItems.name as name,researchChoiceItems.description as description,researchChoiceItems.key as key from (researchChoices join researchChoiceItems on((researchChoices.id = researchChoiceItems.researchChoiceId)));
+##
+create view traitsView as select traits.playerid as playerid,traits.path as path,traits.name as name,traits.added as added,timedtraits.endTime as endTime,timedtraits.expireMessage as expireMessage,timedtraits.triggeringResearch as triggeringResearch from (traits left join timedtraits on((traits.id = timedtraits.traitid)));
+##
+insert into wizardTypes (type) values ('apprentice'), ('wizard'),
+('creator'), ('highwizard'),('senior'),('admin'),('elder'),('sage'),
+('archwizard'),('demigod'),('god'),('owner'),('emeritus');
+##
+create function saveBasicPlayerInformation(p_name text, p_race text,
+p_age bigint, p_gender bigint, p_ghost bigint, p_strength bigint,
+p_intelligence bigint, p_dexterity bigint, p_wisdom bigint,
+p_constitution bigint, p_charisma bigint, p_invisible bigint,
+p_attributes bigint, p_skill bigint, p_research bigint,
+p_unassigned bigint, p_location text, p_money bigint) returns integer as $$
+declare pid integer;
+begin
+    select id into pid from players where name = p_name;
+
+    if pid is not null then
+        update players set race = p_race, age = p_age, gender = p_gender,
+            ghost = p_ghost, strength = p_strength,
+            intelligence = p_intelligence, dexterity = p_dexterity,
+            wisdom = p_wisdom, constitution = p_constitution,
+            charisma = p_charisma, invisible = p_invisible,
+            attributePoints = p_attributes, skillPoints = p_skill,
+            researchPoints = p_research, unassignedExperience = p_unassigned,
+            location = p_location, playerMoney = p_money
+        where id = pid;
+    else
+        insert into players (name, race, age, gender, ghost, strength,
+            intelligence, dexterity, wisdom, constitution, charisma,
+            invisible, attributePoints, skillPoints, researchPoints,
+            unassignedExperience, whenCreated, location, playerMoney)
+        values (p_name, p_race, p_age, p_gender, p_ghost, p_strength,
+            p_intelligence, p_dexterity, p_wisdom, p_constitution, p_charisma,
+            p_invisible, p_attributes, p_skill, p_research, p_unassigned,
+            now(), p_location, p_money)
+        returning id into pid;
+    end if;
+    return pid;
+end;
+$$ language plpgsql;
+##
+create function saveBiologicalInformation(p_playerid bigint,
+p_intoxicated bigint, p_stuffed bigint, p_drugged bigint, p_soaked bigint,
+p_headache bigint) returns void as $$
+begin
+    update biological set intoxicated = p_intoxicated, stuffed = p_stuffed,
+        drugged = p_drugged, soaked = p_soaked, headache = p_headache
+    where playerid = p_playerid;
+
+    if not found then
+        insert into biological (playerid, intoxicated, stuffed, drugged,
+            soaked, headache)
+        values (p_playerid, p_intoxicated, p_stuffed, p_drugged, p_soaked,
+            p_headache);
+    end if;
+end;
+$$ language plpgsql;
+##
+create function saveCombatInformation(p_playerid bigint, p_hp bigint,
+p_maxhp bigint, p_sp bigint, p_maxsp bigint, p_st bigint, p_maxst bigint,
+p_wimpy bigint, p_killList bigint, p_healhp bigint, p_healsp bigint,
+p_healst bigint) returns void as $$
+begin
+    update playerCombatData set hitPoints = p_hp, maxHitPoints = p_maxhp,
+        spellPoints = p_sp, maxSpellPoints = p_maxsp, staminaPoints = p_st,
+        maxStaminaPoints = p_maxst, wimpy = p_wimpy, onKillList = p_killList,
+        timeToHealHP = p_healhp, timeToHealSP = p_healsp,
+        timeToHealST = p_healst
+    where playerid = p_playerid;
+
+    if not found then
+        insert into playerCombatData (playerid, hitPoints, maxHitPoints,
+            spellPoints, maxSpellPoints, staminaPoints, maxStaminaPoints,
+            wimpy, onKillList, timeToHealHP, timeToHealSP, timeToHealST)
+        values (p_playerid, p_hp, p_maxhp, p_sp, p_maxsp, p_st, p_maxst,
+            p_wimpy, p_killList, p_healhp, p_healsp, p_healst);
+    end if;
+end;
+$$ language plpgsql;
+##
+create function saveMaterialAttribute(p_playerid bigint, p_type text,
+p_value text) returns void as $$
+begin
+    update materialAttributes set value = p_value
+    where playerid = p_playerid and type = p_type;
+
+    if not found then
+        insert into materialAttributes (playerid, type, value)
+        values (p_playerid, p_type, p_value);
+    end if;
+end;
+$$ language plpgsql;
+##
+create function saveMaterialAttributes(p_playerid bigint, p_title text,
+p_pretitle text, p_msgin text, p_msgout text, p_magicalin text,
+p_magicalout text, p_home text, p_clone text, p_short text, p_long text)
+returns void as $$
+begin
+    if p_title <> '' then
+        perform saveMaterialAttribute(p_playerid, 'title', p_title);
+    end if;
+    if p_pretitle <> '' then
+        perform saveMaterialAttribute(p_playerid, 'pretitle', p_pretitle);
+    end if;
+    if p_msgin <> '' then
+        perform saveMaterialAttribute(p_playerid, 'messageIn', p_msgin);
+    end if;
+    if p_msgout <> '' then
+        perform saveMaterialAttribute(p_playerid, 'messageOut', p_msgout);
+    end if;
+    if p_magicalin <> '' then
+        perform saveMaterialAttribute(p_playerid, 'magicalMessageIn',
+            p_magicalin);
+    end if;
+    if p_magicalout <> '' then
+        perform saveMaterialAttribute(p_playerid, 'magicalMessageOut',
+            p_magicalout);
+    end if;
+    if p_home <> '' then
+        perform saveMaterialAttribute(p_playerid, 'messageHome', p_home);
+    end if;
+    if p_clone <> '' then
+        perform saveMaterialAttribute(p_playerid, 'messageClone', p_clone);
+    end if;
+    if p_short <> '' then
+        perform saveMaterialAttribute(p_playerid, 'shortDescription',
+            p_short);
+    end if;
+    if p_long <> '' then
+        perform saveMaterialAttribute(p_playerid, 'longDescription', p_long);
+    end if;
+end;
+$$ language plpgsql;
+##
+create function saveGuild(p_playerid bigint, p_guild text, p_title text,
+p_pretitle text, p_rank text, p_level bigint, p_experience bigint,
+p_leftGuild bigint, p_anathema bigint, p_rankAdvancedAt bigint)
+returns void as $$
+begin
+    update guilds set title = p_title, pretitle = p_pretitle, rank = p_rank,
+        level = p_level, experience = p_experience, leftGuild = p_leftGuild,
+        anathema = p_anathema, rankAdvancedAt = p_rankAdvancedAt
+    where playerid = p_playerid and name = p_guild;
+
+    if not found then
+        insert into guilds (playerid, name, title, pretitle, rank, level,
+            experience, leftGuild, anathema, rankAdvancedAt)
+        values (p_playerid, p_guild, p_title, p_pretitle, p_rank, p_level,
+            p_experience, p_leftGuild, p_anathema, p_rankAdvancedAt);
+    end if;
+end;
+$$ language plpgsql;
+##
+create function saveQuest(p_playerid bigint, p_quest text, p_name text,
+p_state text, p_statesCompleted text, p_active bigint, p_completed bigint)
+returns void as $$
+begin
+    update quests set name = p_name, state = p_state,
+        statesCompleted = p_statesCompleted, isActive = p_active,
+        isCompleted = p_completed
+    where playerid = p_playerid and path = p_quest;
+
+    if not found then
+        insert into quests (playerid, path, name, state, statesCompleted,
+            isActive, isCompleted)
+        values (p_playerid, p_quest, p_name, p_state, p_statesCompleted,
+            p_active, p_completed);
+    end if;
+end;
+$$ language plpgsql;
+##
+create function saveResearch(p_playerid bigint, p_path text, p_began bigint,
+p_whenCompleted bigint, p_timeSpent bigint, p_completed bigint,
+p_timeToComplete bigint, p_cooldown bigint) returns void as $$
+begin
+    update research set whenResearchBegan = p_began,
+        whenResearchComplete = p_whenCompleted,
+        timeSpentLearning = p_timeSpent, researchComplete = p_completed,
+        timeToCompleteLearning = p_timeToComplete, cooldown = p_cooldown
+    where playerid = p_playerid and path = p_path;
+
+    if not found then
+        insert into research (playerid, path, whenResearchBegan,
+            whenResearchComplete, timeSpentLearning, researchComplete,
+            timeToCompleteLearning, cooldown)
+        values (p_playerid, p_path, p_began, p_whenCompleted, p_timeSpent,
+            p_completed, p_timeToComplete, p_cooldown);
+    end if;
+end;
+$$ language plpgsql;
+##
+create function pruneResearchChoices(p_playerid bigint) returns void as $$
+begin
+    delete from researchChoiceItems where researchChoiceId in
+        (select id from researchChoices where playerid = p_playerid);
+    delete from researchChoices where playerid = p_playerid;
+end;
+$$ language plpgsql;
+##
+create function saveResearchChoice(p_playerid bigint, p_name text)
+returns integer as $$
+declare choiceId integer;
+begin
+    insert into researchChoices (playerid, name) values (p_playerid, p_name)
+    returning id into choiceId;
+    return choiceId;
+end;
+$$ language plpgsql;
+##
+create function saveResearchChoiceOption(p_choiceId bigint,
+p_selection text, p_type text, p_name text, p_description text,
+p_key text) returns void as $$
+begin
+    insert into researchChoiceItems (researchChoiceId, selectionNumber, type,
+        name, description, key)
+    values (p_choiceId, p_selection, p_type, p_name, p_description, p_key);
+end;
+$$ language plpgsql;
+##
+create function saveOpenResearchTrees(p_playerid bigint, p_path text)
+returns void as $$
+begin
+    if not exists (select 1 from openResearchTrees
+        where playerid = p_playerid and researchTree = p_path) then
+        insert into openResearchTrees (playerid, researchTree)
+        values (p_playerid, p_path);
+    end if;
+end;
+$$ language plpgsql;
+##
+create function saveSkills(p_playerid bigint, p_name text, p_value bigint)
+returns void as $$
+begin
+    update skills set value = p_value
+    where playerid = p_playerid and name = p_name;
+
+    if not found then
+        insert into skills (playerid, name, value)
+        values (p_playerid, p_name, p_value);
+    end if;
+end;
+$$ language plpgsql;
+##
+create function saveTraits(p_playerid bigint, p_path text, p_name text,
+p_added bigint, p_end bigint, p_expire text, p_trigger text)
+returns void as $$
+declare tid integer;
+begin
+    select id into tid from traits
+    where playerid = p_playerid and path = p_path;
+
+    if tid is not null then
+        update traits set name = p_name, added = p_added where id = tid;
+
+        if p_end is not null and p_end <> 0 then
+            update timedtraits set endTime = p_end, expireMessage = p_expire,
+                triggeringResearch = p_trigger
+            where traitid = tid;
+        end if;
+    else
+        insert into traits (playerid, path, name, added)
+        values (p_playerid, p_path, p_name, p_added)
+        returning id into tid;
+
+        if p_end is not null and p_end <> 0 then
+            insert into timedtraits (traitid, endTime, expireMessage,
+                triggeringResearch)
+            values (tid, p_end, p_expire, p_trigger);
+        end if;
+    end if;
+end;
+$$ language plpgsql;
+##
+create function saveTemporaryTraits(p_playerid bigint, p_traits text)
+returns void as $$
+begin
+    update temporaryTraits set traitList = p_traits
+    where playerid = p_playerid;
+
+    if not found then
+        insert into temporaryTraits (playerid, traitList)
+        values (p_playerid, p_traits);
+    end if;
+end;
+$$ language plpgsql;
+##
+create function pruneInventory(p_playerid bigint) returns void as $$
+begin
+    delete from inventory where playerid = p_playerid;
+end;
+$$ language plpgsql;
+##
+create function saveInventoryItem(p_playerid bigint, p_filename text,
+p_data text, p_equipped bigint) returns void as $$
+begin
+    insert into inventory (playerid, fileName, data, isEquipped)
+    values (p_playerid, p_filename, p_data, p_equipped);
+end;
+$$ language plpgsql;
+##
+create function saveFaction(p_playerid bigint, p_path text,
+p_disposition text, p_reputation bigint, p_lastInteraction bigint,
+p_lastReputation bigint, p_numInteractions bigint, p_dispositionTime bigint,
+p_isMember bigint) returns void as $$
+begin
+    update factions set disposition = p_disposition,
+        reputation = p_reputation, lastInteraction = p_lastInteraction,
+        lastReputation = p_lastReputation,
+        numberOfInteractions = p_numInteractions,
+        dispositionTime = p_dispositionTime, isMember = p_isMember
+    where playerid = p_playerid and path = p_path;
+
+    if not found then
+        insert into factions (playerid, path, disposition, reputation,
+            lastInteraction, lastReputation, numberOfInteractions,
+            dispositionTime, isMember)
+        values (p_playerid, p_path, p_disposition, p_reputation,
+            p_lastInteraction, p_lastReputation, p_numInteractions,
+            p_dispositionTime, p_isMember);
+    end if;
+end;
+$$ language plpgsql;
+##
+create function saveCombatStatistics(p_playerName text, p_key text,
+p_name text, p_level bigint, p_timesKilled bigint) returns void as $$
+declare lPlayerId integer;
+begin
+    select id into lPlayerId from players where name = p_playerName;
+
+    if lPlayerId is not null then
+        update combatStatistics set timesKilled = timesKilled + p_timesKilled
+        where playerid = lPlayerId and foeKey = p_key;
+
+        if not found then
+            insert into combatStatistics (name, level, foeKey, timesKilled,
+                playerid)
+            values (p_name, p_level, p_key, p_timesKilled, lPlayerId);
+        end if;
+
+        update combatStatistics set isNemesis = 0, isBestKill = 0
+        where playerid = lPlayerId;
+
+        update combatStatistics set isNemesis = 1 where id =
+            (select id from combatStatistics where playerid = lPlayerId
+             order by timesKilled desc, level desc limit 1);
+
+        update combatStatistics set isBestKill = 1 where id =
+            (select id from combatStatistics where playerid = lPlayerId
+             order by level desc, timesKilled desc limit 1);
+    end if;
+end;
+$$ language plpgsql;
+##
+create function saveCombatStatisticsForRace(p_playerName text, p_race text,
+p_timesKilled bigint) returns void as $$
+declare lPlayerId integer;
+begin
+    select id into lPlayerId from players where name = p_playerName;
+
+    if lPlayerId is not null then
+        update combatStatisticsForRace
+        set timesKilled = timesKilled + p_timesKilled
+        where playerid = lPlayerId and race = p_race;
+
+        if not found then
+            insert into combatStatisticsForRace (playerid, race, timesKilled)
+            values (lPlayerId, p_race, p_timesKilled);
+        end if;
+    end if;
+end;
+$$ language plpgsql;
+##
+create function saveWizardLevel(p_playerid bigint, p_level text)
+returns void as $$
+declare levelId integer;
+begin
+    select id into levelId from wizardTypes where type = p_level;
+
+    if levelId is not null then
+        update wizards set typeId = levelId where playerId = p_playerid;
+
+        if not found then
+            insert into wizards (playerId, typeId)
+            values (p_playerid, levelId);
+        end if;
+    end if;
+end;
+$$ language plpgsql;
+##
+create function saveOpinionOfCharacter(p_playerName text, p_targetKey text,
+p_opinion bigint, p_lastInteraction bigint) returns void as $$
+declare lPlayerId integer;
+begin
+    select id into lPlayerId from players where name = p_playerName;
+
+    if lPlayerId is not null then
+        update opinions set opinion = p_opinion,
+            lastInteraction = p_lastInteraction
+        where playerId = lPlayerId and targetKey = p_targetKey;
+
+        if not found then
+            insert into opinions (playerId, targetKey, opinion,
+                lastInteraction)
+            values (lPlayerId, p_targetKey, p_opinion, p_lastInteraction);
+        end if;
+    end if;
+end;
+$$ language plpgsql;
+##
+create function saveCharacterState(p_playerName text, p_targetKey text,
+p_state text) returns void as $$
+declare lPlayerId integer;
+begin
+    select id into lPlayerId from players where name = p_playerName;
+
+    if lPlayerId is not null then
+        update characterStates set state = p_state
+        where playerId = lPlayerId and targetKey = p_targetKey;
+
+        if not found then
+            insert into characterStates (playerId, targetKey, state)
+            values (lPlayerId, p_targetKey, p_state);
+        end if;
+    end if;
+end;
+$$ language plpgsql;
+##
+insert into players (id,name,race,age,gender,location) values (1,'maeglin','high elf',1,1,'');
+##
+insert into wizards (playerid,typeid) values (1, (select id from wizardTypes where type='owner'));
+##
+insert into players (id,name,race,age,gender,location) values (2,'sonja','high elf',1,2,'');
+##
+insert into wizards (playerid,typeid) values (2, (select id from wizardTypes where type='owner'));
+##
+select setval('players_id_seq', (select max(id) from players));
@@ -0,0 +1,331 @@
+drop view if exists basicPlayerData;
+##
+drop view if exists researchChoicesView;
+##
+drop view if exists traitsView;
+##
+drop table if exists characterStates;
+##
+drop table if exists opinions;
+##
+drop table if exists inventory;
+##
+drop table if exists factions;
+##
+drop table if exists timedtraits;
+##
+drop table if exists traits;
+##
+drop table if exists temporaryTraits;
+##
+drop table if exists skills;
+##
+drop table if exists wizards;
+##
+drop table if exists wizardTypes;
+##
+drop table if exists researchChoiceItems;
+##
+drop table if exists researchChoices;
+##
+drop table if exists research;
+##
+drop table if exists quests;
+##
+drop table if exists playerCombatData;
+##
+drop table if exists openResearchTrees;
+##
+drop table if exists materialAttributes;
+##
+drop table if exists guilds;
+##
+drop table if exists combatStatisticsForRace;
+##
+drop table if exists combatStatistics;
+##
+drop table if exists biological;
+##
+drop table if exists players;
+##
+create table players (
+  "id" integer primary key autoincrement,
+  "name" text collate nocase not null unique,
+  "race" text collate nocase not null,
+  "age" integer not null,
+  "gender" integer not null default 0,
+  "ghost" integer not null default 0,
+  "strength" integer not null default 0,
+  "intelligence" integer not null default 0,
+  "dexterity" integer not null default 0,
+  "wisdom" integer not null default 0,
+  "constitution" integer not null default 0,
+  "charisma" integer not null default 0,
+  "invisible" integer not null default 0,
+  "whenCreated" text collate nocase not null default '0000-00-00 00:00:00',
+  "location" text collate nocase not null,
+  "attributePoints" integer not null default 0,
+  "skillPoints" integer not null default 0,
+  "researchPoints" integer not null default 0,
+  "unassignedExperience" integer default null,
+  "playerMoney" integer default null
+);
+##
+create table biological (
+  "id" integer primary key autoincrement,
+  "playerid" integer not null,
+  "intoxicated" integer not null default 0,
+  "stuffed" integer not null default 0,
+  "drugged" integer not null default 0,
+  "soaked" integer not null default 0,
+  "headache" integer not null default 0,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table combatStatistics (
+  "id" integer primary key autoincrement,
+  "name" text collate nocase not null,
+  "level" integer not null,
+  "foeKey" text collate nocase default null,
+  "timesKilled" integer default null,
+  "playerid" integer not null,
+  "isNemesis" integer not null default 0,
+  "isBestKill" integer not null default 0,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table combatStatisticsForRace (
+  "id" integer primary key autoincrement,
+  "playerid" integer not null,
+  "race" text collate nocase not null,
+  "timesKilled" integer not null,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table guilds (
+  "id" integer primary key autoincrement,
+  "playerid" integer not null,
+  "name" text collate nocase not null,
+  "level" integer not null default 0,
+  "experience" integer not null default 0,
+  "rank" text collate nocase default null,
+  "title" text collate nocase default null,
+  "pretitle" text collate nocase default null,
+  "leftGuild" integer default null,
+  "anathema" integer default null,
+  "rankAdvancedAt" integer default null,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table materialAttributes (
+  "id" integer primary key autoincrement,
+  "playerid" integer not null,
+  "type" text collate nocase not null,
+  "value" text collate nocase not null,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table openResearchTrees (
+  "id" integer primary key autoincrement,
+  "playerid" integer not null,
+  "researchTree" text collate nocase not null,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table playerCombatData (
+  "id" integer primary key autoincrement,
+  "playerid" integer not null,
+  "hitPoints" integer not null,
+  "maxHitPoints" integer not null,
+  "spellPoints" integer not null,
+  "maxSpellPoints" integer not null,
+  "staminaPoints" integer not null,
+  "maxStaminaPoints" integer not null,
+  "wimpy" integer not null default 0,
+  "onKillList" integer not null default 0,
+  "timeToHealHP" integer not null default 0,
+  "timeToHealSP" integer not null default 0,
+  "timeToHealST" integer not null default 0,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table quests (
+  "id" integer primary key autoincrement,
+  "playerid" integer not null,
+  "path" text collate nocase not null,
+  "name" text collate nocase not null,
+  "state" text collate nocase not null,
+  "statesCompleted" text collate nocase default null,
+  "isActive" integer not null default 0,
+  "isCompleted" integer not null default 0,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table research (
+  "id" integer primary key autoincrement,
+  "playerId" integer not null,
+  "path" text collate nocase not null,
+  "whenResearchBegan" integer not null default 0,
+  "whenResearchComplete" integer default null,
+  "timeSpentLearning" integer default null,
+  "researchComplete" integer not null default 0,
+  "timeToCompleteLearning" integer default null,
+  "cooldown" integer default null,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table researchChoices (
+  "id" integer primary key autoincrement,
+  "playerId" integer not null,
+  "name" text collate nocase not null,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table researchChoiceItems (
+  "id" integer primary key autoincrement,
+  "researchChoiceId" integer not null,
+  "selectionNumber" text collate nocase not null,
+  "type" text collate nocase not null,
+  "name" text collate nocase not null,
+  "description" text collate nocase not null,
+  "key" text collate nocase not null
+);
+##
+create table wizardTypes (
+  "id" integer primary key autoincrement,
+  "type" text collate nocase not null
+);
+##
+create table wizards (
+  "id" integer primary key autoincrement,
+  "playerId" integer not null,
+  "typeId" integer not null
+);
+##
+create table skills (
+  "id" integer primary key autoincrement,
+  "playerid" integer not null,
+  "name" text collate nocase not null,
+  "value" integer not null,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table temporaryTraits (
+  "id" integer primary key autoincrement,
+  "playerid" integer not null,
+  "traitList" text collate nocase not null,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table traits (
+  "id" integer primary key autoincrement,
+  "playerid" integer not null,
+  "path" text collate nocase not null,
+  "name" text collate nocase not null,
+  "added" integer not null,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table timedtraits (
+  "id" integer primary key autoincrement,
+  "traitid" integer not null,
+  "endTime" integer not null,
+  "expireMessage" text collate nocase default null,
+  "triggeringResearch" text collate nocase default null,
+  FOREIGN KEY (traitid) REFERENCES traits (id)
+);
+##
+create table factions (
+  "id" integer primary key autoincrement,
+  "playerid" integer not null,
+  "path" text collate nocase not null,
+  "disposition" text collate nocase not null,
+  "reputation" integer not null,
+  "lastInteraction" integer not null,
+  "lastReputation" integer not null,
+  "numberOfInteractions" integer not null,
+  "dispositionTime" integer not null,
+  "isMember" integer not null default 0,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table inventory (
+  "playerid" integer not null,
+  "fileName" text collate nocase not null,
+  "data" blob not null,
+  "isEquipped" integer not null default 0,
+  FOREIGN KEY (playerid) REFERENCES players (id)
+);
+##
+create table opinions (
+  "id" integer primary key autoincrement,
+  "playerId" integer not null,
+  "targetKey" text collate nocase not null,
+  "opinion" integer not null default 0,
+  "lastInteraction" integer default null
+);
+##
+create table characterStates (
+  "id" integer primary key autoincrement,
+  "playerId" integer not null,
+  "targetKey" text collate nocase not null,
+  "state" text collate nocase not null
+);
+##
+create index biological_playerid_idx on biological (playerid);
+##
+create index combatStatistics_playerid_idx on combatStatistics (playerid, foeKey);
+##
+create index combatStatisticsForRace_playerid_idx on combatStatisticsForRace (playerid, race);
+##
+create index guilds_playerid_idx on guilds (playerid, name);
+##
+create index materialAttributes_playerid_idx on materialAttributes (playerid, type);
+##
+create index openResearchTrees_playerid_idx on openResearchTrees (playerid);
+##
+create index playerCombatData_playerid_idx on playerCombatData (playerid);
+##
+create index quests_playerid_idx on quests (playerid, path);
+##
+create index research_playerId_idx on research (playerId, path);
+##
+create index researchChoices_playerId_idx on researchChoices (playerId);
+##
+create index researchChoiceItems_researchChoiceId_idx on researchChoiceItems (researchChoiceId);
+##
+create index wizards_playerId_idx on wizards (playerId);
+##
+create index skills_playerid_idx on skills (playerid, name);
+##
+create index temporaryTraits_playerid_idx on temporaryTraits (playerid);
+##
+create index traits_playerid_idx on traits (playerid, path);
+##
+create index timedtraits_traitid_idx on timedtraits (traitid);
+##
+create index factions_playerid_idx on factions (playerid, path);
+##
+create index inventory_playerid_idx on inventory (playerid);
+##
+create index opinions_playerId_idx on opinions (playerId, targetKey);
+##
+create index characterStates_playerId_idx on characterStates (playerId, targetKey);
+##
+create view basicPlayerData AS select players.name AS name,players.race AS race,players.age AS age,players.gender AS gender,players.ghost AS ghost,players.strength AS strength,players.intelligence AS intelligence,players.dexterity AS dexterity,players.wisdom AS wisdom,players.constitution AS constitution,players.charisma AS charisma,players.invisible AS invisible,biological.intoxicated AS intoxicated,biological.stuffed AS stuffed,biological.drugged AS drugged,biological.soaked AS soaked,biological.headache AS headache,playerCombatData.hitPoints AS hitPoints,playerCombatData.maxHitPoints AS maxHitPoints,playerCombatData.spellPoints AS spellPoints,playerCombatData.maxSpellPoints AS maxSpellPoints,playerCombatData.staminaPoints AS staminaPoints,playerCombatData.maxStaminaPoints AS maxStaminaPoints,playerCombatData.wimpy AS wimpy,playerCombatData.onKillList AS onKillList,playerCombatData.timeToHealHP AS timeToHealHP,playerCombatData.timeToHealSP AS timeToHealSP,playerCombatData.timeToHealST AS timeToHealST,players.whenCreated AS whenCreated,players.location AS location,players.attributePoints AS availableAttributePoints,players.skillPoints AS availableSkillPoints,players.researchPoints AS availableResearchPoints,players.unassignedExperience AS unassignedExperience,players.playerMoney AS playerMoney,players.id AS playerId from ((players join biological on((players.id = biological.playerid))) join playerCombatData on((players.id = playerCombatData.playerid)));
+##
+create view researchChoicesView AS select researchChoices.playerId AS playerId,researchChoices.name AS Choice,researchChoiceItems.selectionNumber AS selectionNumber,researchChoiceItems.type AS type,researchChoiceItems.name AS name,researchChoiceItems.description AS description,researchChoiceItems.key AS key from (researchChoices join researchChoiceItems on((researchChoices.id = researchChoiceItems.researchChoiceId)));
+##
+create view traitsView AS select traits.playerid AS playerid,traits.path AS path,traits.name AS name,traits.added AS added,timedtraits.endTime AS endTime,timedtraits.expireMessage AS expireMessage,timedtraits.triggeringResearch AS triggeringResearch from (traits left join timedtraits on((traits.id = timedtraits.traitid)));
+##
+insert into wizardTypes (type) values ('apprentice'), ('wizard'),
+('creator'), ('highwizard'),('senior'),('admin'),('elder'),('sage'),
+('archwizard'),('demigod'),('god'),('owner'),('emeritus');
+##
+insert into players (id,name,race,age,gender,location) values (1,'maeglin','high elf',1,1,'');
+##
+insert into wizards (playerid,typeid) values (1, (select id from wizardTypes where type='owner'));
+##
+insert into players (id,name,race,age,gender,location) values (2,'sonja','high elf',1,2,'');
+##
+insert into wizards (playerid,typeid) values (2, (select id from wizardTypes where type='owner'));
@@ -0,0 +1,94 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+inherit "/lib/tests/framework/testFixture.c";
+
+object Login;
+object Registry;
+object *LoadedPlayers;
+
+/////////////////////////////////////////////////////////////////////////////
+void Init()
+{
+    setRestoreCaller(this_object());
+    object database = clone_object("/lib/tests/modules/secure/fakeDatabase.c");
+    database->PrepDatabase();
+
+    object dataAccess = clone_object("/lib/modules/secure/dataAccess.c");
+    dataAccess->savePlayerData(database->Gorthaur());
+
+    destruct(dataAccess);
+    destruct(database);
+
+    Registry = load_object(
+        "/lib/modules/secure/dataServices/backends/backendRegistry.c");
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void Setup()
+{
+    Login = clone_object("/lib/tests/support/services/testLogin.c");
+    LoadedPlayers = ({});
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void CleanUp()
+{
+    Registry->useBackend("mysql");
+    foreach(object player in LoadedPlayers - ({ 0 }))
+    {
+        destruct(player);
+    }
+    destruct(Login);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void RequestPlayerObjectCallsBackWithRestoredPlayer()
+{
+    Login->requestPlayerObject("gorthaur", (: LoadedPlayers += ({ $1 }) :));
+    Login->testCompleteTypeRequests();
+
+    ExpectEq(1, sizeof(LoadedPlayers));
+    ExpectTrue(objectp(LoadedPlayers[0]));
+    ExpectEq("Gorthaur", LoadedPlayers[0]->Name());
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void ConcurrentLoginsForSameNameShareOnePlayerObject()
+{
+    Login->requestPlayerObject("gorthaur", (: LoadedPlayers += ({ $1 }) :));
+    Login->requestPlayerObject("gorthaur", (: LoadedPlayers += ({ $1 }) :));
+    Login->requestPlayerObject("gorthaur", (: LoadedPlayers += ({ $1 }) :));
+
+    ExpectEq(1, Login->testPendingTypeRequests());
+    ExpectFalse(sizeof(LoadedPlayers));
+
+    Login->testCompleteTypeRequests();
+
+    ExpectEq(3, sizeof(LoadedPlayers));
+    ExpectTrue(objectp(LoadedPlayers[0]));
+    ExpectEq(LoadedPlayers[0], LoadedPlayers[1]);
+    ExpectEq(LoadedPlayers[0], LoadedPlayers[2]);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void ConcurrentLoginsForDifferentNamesDoNotShare()
+{
+    Login->requestPlayerObject("gorthaur", (: LoadedPlayers += ({ $1 }) :));
+    Login->requestPlayerObject("earl", (: LoadedPlayers += ({ $1 }) :));
+
+    ExpectEq(2, Login->testPendingTypeRequests());
+    Login->testCompleteTypeRequests();
+
+    ExpectEq(2, sizeof(LoadedPlayers));
+    ExpectNotEq(LoadedPlayers[0], LoadedPlayers[1]);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void GetPlayerObjectRefusesWhenBackendIsAsynchronous()
+{
+    Registry->useBackend("postgres");
+    ExpectFalse(Login->getPlayerObject("gorthaur"));
+    ExpectEq(0, Login->testPendingTypeRequests());
+}
@@ -0,0 +1,260 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+
+// Measures the cost of persistence.c save() and restore() for synthetic
+// players of increasing size. This is not a test fixture - it is run by
+// hand (or by a CI job) and emits one JSON object per measurement, ie:
+//   call /lib/tests/modules/secure/persistenceBenchmark.c executeBenchmark
+// Each case runs in its own call_out so that the larger players do not
+// share an eval budget with the smaller ones.
+private nosave string Registry =
+    "/lib/modules/secure/dataServices/backends/backendRegistry.c";
+private nosave string InventoryItem =
+    "/lib/instances/items/weapons/swords/long-sword.c";
+
+private nosave string *DefaultBackends = ({ "mysql", "sqlite" });
+private nosave int *DefaultSizes = ({ 1, 10, 25, 50, 100 });
+private nosave int Iterations = 5;
+
+private nosave mixed *pendingCases = ({});
+private nosave string *results = ({});
+private nosave string outputFile = 0;
+private nosave string originalBackend = 0;
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask string *supportFiles(string directory, int count,
+    string syntheticFormat)
+{
+    string *ret = map(get_dir(directory + "*.c") || ({}),
+        (: $2 + $1 :), directory);
+
+    if (sizeof(ret) > count)
+    {
+        ret = ret[0..(count - 1)];
+    }
+
+    // Once the real support objects run out, paths that do not exist are
+    // used. The dictionaries treat those as plain data, which is fine for
+    // measuring the data services.
+    for (int i = sizeof(ret); i < count; i++)
+    {
+        ret += ({ sprintf(syntheticFormat, i) });
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask mapping syntheticPlayer(string name, int size)
+{
+    object database = clone_object("/lib/tests/modules/secure/fakeDatabase.c");
+    mapping ret = database->Gorthaur();
+    destruct(database);
+
+    ret["name"] = name;
+    m_delete(ret, "playerId");
+
+    ret["research"] = ([]);
+    foreach(string research in supportFiles("/lib/tests/support/research/",
+        size, "/lib/tests/support/research/benchmarkResearch%d.c"))
+    {
+        ret["research"][research] = ([
+            "cooldown": 0,
+            "research complete": 1,
+            "time spent learning": 1,
+            "time to complete learning": 0,
+            "when research began": 3,
+            "when research complete": 4
+        ]);
+    }
+
+    ret["traits"] = ([]);
+    foreach(string trait in supportFiles("/lib/tests/support/traits/",
+        size, "/lib/tests/support/traits/benchmarkTrait%d.c"))
+    {
+        ret["traits"][trait] = ([
+            "added": 5555,
+            "name": "Benchmark Trait"
+        ]);
+    }
+
+    ret["quests"] = ([]);
+    for (int i = 0; i < size; i++)
+    {
+        ret["quests"][sprintf("lib/tests/support/quests/benchmarkQuest%d.c",
+            i)] = ([
+                "is active": 1,
+                "is completed": 0,
+                "name": sprintf("Benchmark quest %d", i),
+                "state": "in progress",
+                "states completed": "started##in progress"
+            ]);
+    }
+
+    object item = clone_object(InventoryItem);
+    string itemData = item->query("delta");
+    destruct(item);
+
+    ret["inventory"] = ([]);
+    for (int i = 0; i < size; i++)
+    {
+        ret["inventory"][sprintf("%s#%d", InventoryItem[0..<3], i + 1)] = ([
+            "data": itemData,
+            "isEquipped": 0
+        ]);
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask int elapsedMicroseconds(int *start, int *end)
+{
+    return (end[0] - start[0]) * 1000000 + (end[1] - start[1]);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+private nomask void destructPlayer(object player)
+{
+    foreach(object item in all_inventory(player))
+    {
+        destruct(item);
+    }
+    destruct(player);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask mapping benchmarkCase(string backend, int size)
+{
+    object registry = load_object(Registry);
+    registry->useBackend(backend);
+
+    object database = clone_object("/lib/tests/modules/secure/fakeDatabase.c");
+    database->PrepDatabase();
+    destruct(database);
+
+    string name = sprintf("benchmark%d", size);
+    object dataAccess = clone_object("/lib/modules/secure/dataAccess.c");
+    dataAccess->savePlayerData(syntheticPlayer(name, size));
+    destruct(dataAccess);
+
+    mapping ret = ([
+        "backend": backend,
+        "size": size,
+        "iterations": Iterations
+    ]);
+
+    object databaseBackend = registry->activeBackend();
+    foreach(string operation in ({ "restore", "save" }))
+    {
+        ret[operation] = ([ "eval cost": 0, "queries": 0, "statements": 0,
+            "microseconds": 0 ]);
+    }
+
+    for (int i = 0; i < Iterations; i++)
+    {
+        object player = clone_object("/lib/realizations/player.c");
+
+        int queries = databaseBackend->requestsMade();
+        int statements = databaseBackend->statementsExecuted();
+        int evalCost = get_eval_cost();
+        int *start = utime();
+        player->restore(name);
+        ret["restore"]["microseconds"] += elapsedMicroseconds(start, utime());
+        ret["restore"]["eval cost"] += evalCost - get_eval_cost();
+        ret["restore"]["queries"] += databaseBackend->requestsMade() - queries;
+        ret["restore"]["statements"] +=
+            databaseBackend->statementsExecuted() - statements;
+
+        queries = databaseBackend->requestsMade();
+        statements = databaseBackend->statementsExecuted();
+        evalCost = get_eval_cost();
+        start = utime();
+        player->save();
+        ret["save"]["microseconds"] += elapsedMicroseconds(start, utime());
+        ret["save"]["eval cost"] += evalCost - get_eval_cost();
+        ret["save"]["queries"] += databaseBackend->requestsMade() - queries;
+        ret["save"]["statements"] +=
+            databaseBackend->statementsExecuted() - statements;
+
+        destructPlayer(player);
+    }
+
+    foreach(string operation in ({ "restore", "save" }))
+    {
+        foreach(string measurement in m_indices(ret[operation]))
+        {
+            ret[operation][measurement] /= Iterations;
+        }
+    }
+    return ret;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask string formatResult(mapping result)
+{
+    return sprintf("{\"backend\":\"%s\",\"size\":%d,\"iterations\":%d,"
+        "\"restore\":{\"evalCost\":%d,\"queries\":%d,\"statements\":%d,"
+        "\"microseconds\":%d},"
+        "\"save\":{\"evalCost\":%d,\"queries\":%d,\"statements\":%d,"
+        "\"microseconds\":%d}}",
+        result["backend"], result["size"], result["iterations"],
+        result["restore"]["eval cost"], result["restore"]["queries"],
+        result["restore"]["statements"], result["restore"]["microseconds"],
+        result["save"]["eval cost"], result["save"]["queries"],
+        result["save"]["statements"], result["save"]["microseconds"]);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask void runNextCase()
+{
+    if (sizeof(pendingCases))
+    {
+        mixed *benchmark = pendingCases[0];
+        pendingCases = pendingCases[1..];
+
+        string line;
+        string error = catch (line = formatResult(
+            benchmarkCase(benchmark[0], benchmark[1])); nolog);
+
+        if (error)
+        {
+            line = sprintf("{\"backend\":\"%s\",\"size\":%d,\"error\":%Q}",
+                benchmark[0], benchmark[1], error);
+        }
+        results += ({ line });
+        debug_message(line + "\n", 0x5);
+
+        call_out("runNextCase", 0);
+    }
+    else
+    {
+        load_object(Registry)->useBackend(originalBackend);
+
+        if (outputFile)
+        {
+            write_file(outputFile, implode(results, "\n") + "\n", 1);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask varargs void executeBenchmark(string file, string *backends,
+    int *sizes)
+{
+    setRestoreCaller(this_object());
+
+    outputFile = file;
+    originalBackend = load_object(Registry)->activeBackendName();
+    results = ({});
+    pendingCases = ({});
+
+    foreach(string backend in (backends || DefaultBackends))
+    {
+        foreach(int size in (sizes || DefaultSizes))
+        {
+            pendingCases += ({ ({ backend, size }) });
+        }
+    }
+    call_out("runNextCase", 0);
+}
@@ -7,6 +7,8 @@ inherit "/lib/tests/framework/testFixture.c";
 #include "/lib/include/inventory.h"
 
 object Player;
+object RestoredPlayer;
+string RestoreError;
 
 /////////////////////////////////////////////////////////////////////////////
 void Init()
@@ -593,6 +595,52 @@ void GetNemesisReturnsNemesis()
         Player->getNemesis("gorthaur"));
 }
 
+/////////////////////////////////////////////////////////////////////////////
+void BufferedCombatStatisticsArePersistedOnSave()
+{
+    Player->restore("gorthaur");
+
+    object foe = clone_object("/lib/realizations/monster.c");
+    foe->Name("Grog");
+    foe->Race("troll");
+    foe->effectiveLevel(30);
+
+    Player->saveCombatStatistics(Player, foe);
+    Player->saveCombatStatistics(Player, foe);
+    Player->save();
+    destruct(Player);
+
+    Player = clone_object("/lib/realizations/player.c");
+    Player->restore("gorthaur");
+
+    ExpectEq((["name":"Grog",
+               "level" : 30,
+               "key" : "lib/realizations/monster.c#Grog",
+               "times killed" : 2]),
+        Player->getBestKill());
+    ExpectTrue(Player->racialKillsMeetCount("troll", 2));
+    ExpectFalse(Player->racialKillsMeetCount("troll", 3));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void BufferedCombatStatisticsSurviveDestructWithoutSave()
+{
+    Player->restore("gorthaur");
+
+    object foe = clone_object("/lib/realizations/monster.c");
+    foe->Name("Grog");
+    foe->Race("troll");
+    foe->effectiveLevel(30);
+
+    Player->saveCombatStatistics(Player, foe);
+    destruct(Player);
+
+    Player = clone_object("/lib/realizations/player.c");
+    Player->restore("gorthaur");
+
+    ExpectTrue(Player->racialKillsMeetCount("troll", 1));
+}
+
 /////////////////////////////////////////////////////////////////////////////
 void PlayerTypeReturnsForWizard()
 {
@@ -650,3 +698,40 @@ void HeartBeatChecksForLinkDeathThenSavesAndDestroysTheLinkDead()
 
     ExpectEq("/lib/environment/environment", Player->savedLocation());
 }
+
+/////////////////////////////////////////////////////////////////////////////
+void RestoreCallsBackWithRestoredPlayer()
+{
+    RestoredPlayer = 0;
+    RestoreError = "not called";
+    Player->restore("gorthaur", (: RestoredPlayer = $1, RestoreError = $2 :));
+
+    ExpectEq(Player, RestoredPlayer);
+    ExpectFalse(RestoreError);
+    ExpectEq("Gorthaur", RestoredPlayer->Name());
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void FailedRestoreIsReportedAndDoesNotBlockLaterRestores()
+{
+    object handler = clone_object("/lib/tests/support/events/onRestoreSucceededSubscriber.c");
+    Player->registerEvent(handler);
+
+    RestoredPlayer = 0;
+    RestoreError = 0;
+    Player->restore("gorthaur", (: RestoredPlayer = $1, RestoreError = $2 :));
+
+    ExpectEq(Player, RestoredPlayer);
+    ExpectSubStringMatch("event handler: onRestoreSucceeded called",
+        RestoreError);
+
+    Player->unregisterEvent(handler);
+    destruct(handler);
+
+    RestoredPlayer = 0;
+    RestoreError = "not called";
+    Player->restore("gorthaur", (: RestoredPlayer = $1, RestoreError = $2 :));
+
+    ExpectEq(Player, RestoredPlayer);
+    ExpectFalse(RestoreError);
+}
@@ -364,6 +364,31 @@ void HasTraitOfRootReturnsCorrectlyForQueriedRoot()
     ExpectTrue(Traits->hasTraitOfRoot("disfigured"));
 }
 
+/////////////////////////////////////////////////////////////////////////////
+void HasTraitOfRootIsFalseOnceAllTraitsOfRootAreRemoved()
+{
+    ExpectTrue(Traits->addTrait("lib/tests/support/traits/testGeneticTrait.c"));
+    ExpectTrue(Traits->addTrait("lib/tests/support/traits/testHealthTrait.c"));
+    ExpectTrue(Traits->hasTraitOfRoot("disfigured"));
+    ExpectTrue(Traits->removeTrait("lib/tests/support/traits/testGeneticTrait.c"));
+    ExpectTrue(Traits->hasTraitOfRoot("disfigured"));
+    ExpectTrue(Traits->removeTrait("lib/tests/support/traits/testHealthTrait.c"));
+    ExpectFalse(Traits->hasTraitOfRoot("disfigured"));
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void TraitsReturnsOnlyTraitsOfRequestedType()
+{
+    ExpectEq(({}), Traits->Traits("health"), "no health traits");
+    ExpectTrue(Traits->addTrait("lib/tests/support/traits/testGeneticTrait.c"));
+    ExpectTrue(Traits->addTrait("lib/tests/support/traits/testHealthTrait.c"));
+    ExpectTrue(Traits->addTrait("lib/tests/support/traits/testPersonalityTrait.c"));
+
+    ExpectEq(({ "lib/tests/support/traits/testHealthTrait.c" }), 
+        Traits->Traits("health"), "health traits");
+    ExpectEq(3, sizeof(Traits->Traits()), "all traits");
+}
+
 /////////////////////////////////////////////////////////////////////////////
 void TraitsWithDurationAreRemovedWhenTheyExpire()
 {
@@ -439,3 +464,17 @@ void TraitsWithSustainedEffectsAreRemovedAfterResearchInactivated()
     Traits->heart_beat();
     ExpectFalse(Traits->isTraitOf(trait), "trait has been removed");
 }
+
+/////////////////////////////////////////////////////////////////////////////
+void TraitBonusesAreUpdatedWhenTraitsChange()
+{
+    ExpectEq(0, Traits->traitsBonusTo("long sword"));
+    ExpectTrue(Traits->addTrait("lib/tests/support/traits/testTrait.c"));
+    ExpectEq(1, Traits->traitsBonusTo("long sword"));
+    ExpectEq((["lib/tests/support/traits/testTrait.c": 1]),
+        Traits->traitsBonusSources("long sword"));
+
+    ExpectTrue(Traits->removeTrait("lib/tests/support/traits/testTrait.c"));
+    ExpectEq(0, Traits->traitsBonusTo("long sword"));
+    ExpectEq(([]), Traits->traitsBonusSources("long sword"));
+}
@@ -0,0 +1,80 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+inherit "/lib/tests/framework/testFixture.c";
+
+object Monster;
+object Room;
+string Destination = "/lib/tests/support/environment/toLocation.c";
+string Island = "/lib/tests/support/environment/fromLocation.c";
+
+/////////////////////////////////////////////////////////////////////////////
+void Setup()
+{
+    Room = clone_object("/lib/tests/support/environment/testEnvironment.c");
+    Room->testAddExit("east", Destination);
+
+    Monster = clone_object("/lib/realizations/wanderingMonster.c");
+    move_object(Monster, Room);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void CleanUp()
+{
+    destruct(Monster);
+    destruct(Room);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void AddWaypointAddsValidLocations()
+{
+    Monster->addWaypoint(Destination);
+    Monster->addWaypoint(Island);
+    ExpectEq(({ Destination, Island }), Monster->waypoints());
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void AddWaypointRaisesErrorForInvalidLocation()
+{
+    string err = catch(Monster->addWaypoint("/lib/tests/support/blarg.c"));
+    ExpectEq("*ERROR in wanderingMonster.c: '/lib/tests/support/blarg.c' is "
+        "not a valid location.\n", err);
+    ExpectEq(({}), Monster->waypoints());
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void NextWanderingStepFollowsRouteToWaypoint()
+{
+    Monster->addWaypoint(Destination);
+    ExpectEq("east", Monster->nextWanderingStep());
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void NextWanderingStepSkipsUnreachableWaypoints()
+{
+    Monster->addWaypoint(Island);
+    Monster->addWaypoint(Destination);
+    ExpectEq("east", Monster->nextWanderingStep());
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void NextWanderingStepReturnsZeroWithoutReachableWaypoints()
+{
+    ExpectFalse(Monster->nextWanderingStep());
+
+    Monster->addWaypoint(Island);
+    ExpectFalse(Monster->nextWanderingStep());
+}
+
+/////////////////////////////////////////////////////////////////////////////
+void NextWanderingStepReturnsZeroOnceOnlyWaypointIsReached()
+{
+    Monster->addWaypoint(Destination);
+
+    move_object(Monster, load_object(Destination));
+    ExpectFalse(Monster->nextWanderingStep());
+
+    move_object(Monster, Room);
+    ExpectEq("east", Monster->nextWanderingStep());
+}
@@ -0,0 +1,11 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+inherit "/lib/core/objectRegistry.c";
+
+/////////////////////////////////////////////////////////////////////////////
+protected string preloadManifest()
+{
+    return "/lib/tests/support/preloadManifest.txt";
+}
@@ -0,0 +1,12 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+inherit "/lib/environment/environment.c";
+
+/////////////////////////////////////////////////////////////////////////////
+public void Setup()
+{
+    setTerrain("/lib/tests/support/environment/fakeTerrain.c");
+    setStateMachine(load_object("/lib/tests/support/core/testStateMachine.c"));
+}
@@ -72,3 +72,15 @@ public void testAddShop(string shop)
 {
     addShop(shop);
 }
+
+/////////////////////////////////////////////////////////////////////////////
+public void testSetCoordinates(string region, int x, int y)
+{
+    setCoordinates(region, x, y);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public void testAddLandmark(string name)
+{
+    addLandmark(name);
+}
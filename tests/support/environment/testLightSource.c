@@ -18,3 +18,9 @@ public nomask varargs void testAddSourceOfLight(int magnitude, string state, str
 {
     return addSourceOfLight(magnitude, state, period, season);
 }
+
+/////////////////////////////////////////////////////////////////////////////
+public nomask varargs void testAddSeasonDescription(string season, string *list, string state)
+{
+    addSeasonDescription(season, list, state);
+}
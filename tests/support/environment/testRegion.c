@@ -0,0 +1,15 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+inherit "/lib/environment/region.c";
+
+/////////////////////////////////////////////////////////////////////////////
+public void Setup()
+{
+    Name("test region");
+    setDimensions(40, 40);
+    addRoom(15, 15, "/lib/tests/support/environment/toLocation.c", "#");
+    addRoom(16, 15, "/lib/tests/support/environment/fromLocation.c", "~");
+    addRoom(15, 16, "/lib/tests/support/environment/fakeEnvironment.c");
+}
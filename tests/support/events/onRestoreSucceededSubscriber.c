@@ -0,0 +1,11 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+
+/////////////////////////////////////////////////////////////////////////////
+public void onRestoreSucceeded(object caller)
+{
+    raise_error(sprintf("event handler: onRestoreSucceeded called: %s",
+        program_name(caller)));
+}
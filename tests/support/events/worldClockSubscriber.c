@@ -0,0 +1,26 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+
+private string *recordedTransitions = ({});
+
+/////////////////////////////////////////////////////////////////////////////
+public void onTimeOfDayChanged(object caller, mapping data)
+{
+    recordedTransitions += ({ sprintf("time of day: %s -> %s",
+        data["previous"], data["current"]) });
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public void onSeasonChanged(object caller, mapping data)
+{
+    recordedTransitions += ({ sprintf("season: %s -> %s",
+        data["previous"], data["current"]) });
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public string *transitions()
+{
+    return recordedTransitions + ({});
+}
@@ -0,0 +1,45 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+inherit "/lib/modules/secure/login.c";
+
+// Player type lookups are held until the test releases them so that several
+// logins can be made while the database is still busy with the first.
+private mixed *typeRequests = ({});
+
+/////////////////////////////////////////////////////////////////////////////
+protected object dataAccess()
+{
+    return this_object();
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public string playerType(string name)
+{
+    return load_object("/lib/modules/secure/dataAccess.c")->playerType(name);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public void playerTypeAsync(string name, closure callback)
+{
+    typeRequests += ({ ({ name, callback }) });
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public int testPendingTypeRequests()
+{
+    return sizeof(typeRequests);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public void testCompleteTypeRequests()
+{
+    mixed *requests = typeRequests;
+    typeRequests = ({});
+
+    foreach(mixed *request in requests)
+    {
+        funcall(request[1], playerType(request[0]), request[0]);
+    }
+}
@@ -0,0 +1,45 @@
+//*****************************************************************************
+// Copyright (c) 2018 - Allen Cummings, RealmsMUD, All rights reserved. See
+//                      the accompanying LICENSE file for details.
+//*****************************************************************************
+#include <pgsql.h>
+
+inherit "/lib/modules/secure/dataServices/backends/postgresBackend.c";
+
+private string *sentQueries = ({});
+
+/////////////////////////////////////////////////////////////////////////////
+protected void ensureConnection()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////
+protected int submitQuery(string query)
+{
+    sentQueries += ({ query });
+    return sizeof(sentQueries);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public string sanitizeString(string value)
+{
+    return value || "";
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public string *testSentQueries()
+{
+    return sentQueries;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public void testReturnRows(int id, mixed *rows)
+{
+    onDatabaseEvent(PGRES_TUPLES_OK, ({ ({ "column" }) }) + rows, id);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+public void testFailQuery(int id, string error)
+{
+    onDatabaseEvent(PGRES_FATAL_ERROR, error, id);
+}